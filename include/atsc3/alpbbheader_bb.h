@@ -1,6 +1,6 @@
 /* -*- c++ -*- */
 /*
- * Copyright 2021 Ron Economos.
+ * Copyright 2021-2025 Ron Economos.
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
@@ -19,6 +19,15 @@ namespace gr {
      * \brief <+description of block+>
      * \ingroup atsc3
      *
+     * When the output stream is not connected, every baseband frame
+     * is published instead as a PDU on the "frames" message port, as
+     * Kbch / 8 MSB first packed bytes whatever the packed mode. The
+     * frames are not scrambled. The PDUs come from a pool of
+     * preallocated frames and are reused once downstream blocks have
+     * released them. While every frame of the pool is in flight no
+     * input is consumed, so the downstream block sets the pace.
+     * Frames that complete an LLS table carry the "lls" key in their
+     * metadata.
      */
     class ATSC3_API alpbbheader_bb : virtual public gr::block
     {
@@ -33,7 +42,7 @@ namespace gr {
        * class. atsc3::alpbbheader_bb::make is the public interface for
        * creating new instances.
        */
-      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_lls_insertion_mode_t llsmode, atsc3_lls_service_count_t llscount);
+      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_lls_insertion_mode_t llsmode, atsc3_lls_service_count_t llscount, atsc3_packed_mode_t packed = PACKED_OFF);
     };
 
   } // namespace atsc3
@@ -301,6 +301,28 @@ namespace gr {
       LLS_TWO_SERVICE,
     };
 
+    /*
+     * Stream format of the baseband blocks. PACKED_ON carries 8 bits
+     * per byte, MSB first, so every frame length is in bytes instead
+     * of bits. In both formats an "lls" tag marks the first item of
+     * the work call output that holds the frame with the LLS table.
+     */
+    enum atsc3_packed_mode_t {
+      PACKED_OFF = 0,
+      PACKED_ON,
+    };
+
+    /*
+     * Hybrid time interleaver addressing of the frame mappers.
+     * TI_ADDRESS_TABLE stores the interleaver addresses of a frame,
+     * 4 bytes per PLP cell. TI_ADDRESS_GENERATED computes them every
+     * frame and needs about 4 bytes per FEC block cell.
+     */
+    enum atsc3_ti_address_mode_t {
+      TI_ADDRESS_TABLE = 0,
+      TI_ADDRESS_GENERATED,
+    };
+
   } // namespace atsc3
 } // namespace gr
 
@@ -335,5 +357,7 @@ typedef gr::atsc3::atsc3_pilotgenerator_mode_t atsc3_pilotgenerator_mode_t;
 typedef gr::atsc3::atsc3_cyclicprefixer_mode_t atsc3_cyclicprefixer_mode_t;
 typedef gr::atsc3::atsc3_lls_insertion_mode_t atsc3_lls_insertion_mode_t;
 typedef gr::atsc3::atsc3_lls_service_count_t atsc3_lls_service_count_t;
+typedef gr::atsc3::atsc3_packed_mode_t atsc3_packed_mode_t;
+typedef gr::atsc3::atsc3_ti_address_mode_t atsc3_ti_address_mode_t;
 
 #endif /* INCLUDED_ATSC3_CONFIG_H */
@@ -16,9 +16,12 @@ namespace gr {
   namespace atsc3 {
 
     /*!
-     * \brief <+description of block+>
+     * \brief A/322 baseband scrambler.
      * \ingroup atsc3
      *
+     * As a stream block it writes every frame to a separate output
+     * buffer. fec_encoder_bb scrambles each frame in place as it
+     * writes it into the FECFRAME it encodes, without this copy.
      */
     class ATSC3_API bbscrambler_bb : virtual public gr::sync_block
     {
@@ -33,7 +36,7 @@ namespace gr {
        * class. atsc3::bbscrambler_bb::make is the public interface for
        * creating new instances.
        */
-      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode);
+      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed = PACKED_OFF);
     };
 
   } // namespace atsc3
@@ -33,7 +33,7 @@ namespace gr {
        * class. atsc3::bch_bb::make is the public interface for
        * creating new instances.
        */
-      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode);
+      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed = PACKED_OFF);
     };
 
   } // namespace atsc3
@@ -0,0 +1,73 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_FEC_ENCODER_BB_H
+#define INCLUDED_ATSC3_FEC_ENCODER_BB_H
+
+#include <atsc3/api.h>
+#include <atsc3/atsc3_config.h>
+#include <gnuradio/block.h>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*!
+     * \brief Baseband scrambler, outer code and LDPC encoder in one block.
+     * \ingroup atsc3
+     *
+     * Input is Kbch / 8 MSB first packed bytes per FECFRAME. Output is
+     * the FECFRAME packed (PACKED_ON) or one bit per byte (PACKED_OFF),
+     * as produced by bbscrambler_bb, bch_bb and ldpc_bb in series.
+     *
+     * When the input stream is not connected, the baseband frames
+     * are taken as PDUs from the "frames" message port, for example
+     * from alpbbheader_bb, and encoded straight into the output. The
+     * frames must not be scrambled, the block scrambles them itself.
+     */
+    class ATSC3_API fec_encoder_bb : virtual public gr::block
+    {
+     public:
+      typedef std::shared_ptr<fec_encoder_bb> sptr;
+
+      /*!
+       * \brief Return a shared_ptr to a new instance of atsc3::fec_encoder_bb.
+       *
+       * To avoid accidental use of raw pointers, atsc3::fec_encoder_bb's
+       * constructor is in a private implementation
+       * class. atsc3::fec_encoder_bb::make is the public interface for
+       * creating new instances.
+       */
+      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed);
+
+      /*!
+       * \brief Scratch buffers taken from the shared buffer pool.
+       *
+       * The pool is shared by every fec_encoder_bb with the same
+       * frame size and packed mode, the counters cover all of them.
+       */
+      virtual uint64_t pool_acquired() const = 0;
+
+      /*!
+       * \brief Scratch buffers allocated because the pool was empty.
+       */
+      virtual uint64_t pool_overflows() const = 0;
+
+      /*!
+       * \brief Buffers owned by the pool.
+       */
+      virtual int pool_buffers() const = 0;
+
+      /*!
+       * \brief Largest number of pool buffers in use at once.
+       */
+      virtual int pool_peak() const = 0;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_FEC_ENCODER_BB_H */
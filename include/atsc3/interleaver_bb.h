@@ -33,7 +33,7 @@ namespace gr {
        * class. atsc3::interleaver_bb::make is the public interface for
        * creating new instances.
        */
-      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_constellation_t constellation);
+      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_constellation_t constellation, atsc3_packed_mode_t packed = PACKED_OFF);
     };
 
   } // namespace atsc3
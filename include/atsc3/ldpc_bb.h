@@ -33,7 +33,12 @@ namespace gr {
        * class. atsc3::ldpc_bb::make is the public interface for
        * creating new instances.
        */
-      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate);
+      static sptr make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_packed_mode_t packed = PACKED_OFF, int threads = 1);
+
+      /*!
+       * \brief Name of the parity kernels selected for this CPU.
+       */
+      virtual std::string kernel_name() const = 0;
     };
 
   } // namespace atsc3
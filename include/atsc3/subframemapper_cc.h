@@ -33,7 +33,7 @@ namespace gr {
        * class. atsc3::subframemapper_cc::make is the public interface for
        * creating new instances.
        */
-      static sptr make(atsc3_framesize_t framesizesub0, atsc3_code_rate_t ratesub0, atsc3_plp_fec_mode_t fecmodesub0, atsc3_constellation_t constellationsub0, atsc3_fftsize_t fftsizesub0, int numpayloadsymssub0, int numpreamblesyms, atsc3_guardinterval_t guardintervalsub0, atsc3_pilotpattern_t pilotpatternsub0, atsc3_scattered_pilot_boost_t pilotboostsub0, atsc3_first_sbs_t firstsbs, atsc3_frequency_interleaver_t fimodesub0, atsc3_time_interleaver_mode_t timodesub0, atsc3_time_interleaver_depth_t tidepthsub0, int tiblockssub0, int tifecblocksmaxsub0, int tifecblockssub0, int plpsizesub0, atsc3_lls_insertion_mode_t llsmodesub0, atsc3_reduced_carriers_t credsub0, atsc3_miso_t misomodesub0, atsc3_framesize_t framesizesub1, atsc3_code_rate_t ratesub1, atsc3_plp_fec_mode_t fecmodesub1, atsc3_constellation_t constellationsub1, atsc3_fftsize_t fftsizesub1, int numpayloadsymssub1, atsc3_guardinterval_t guardintervalsub1, atsc3_pilotpattern_t pilotpatternsub1, atsc3_scattered_pilot_boost_t pilotboostsub1, atsc3_frequency_interleaver_t fimodesub1, atsc3_time_interleaver_mode_t timodesub1, atsc3_time_interleaver_depth_t tidepthsub1, int tiblockssub1, int tifecblocksmaxsub1, int tifecblockssub1, int plpsizesub1, atsc3_lls_insertion_mode_t llsmodesub1, atsc3_reduced_carriers_t credsub1, atsc3_miso_t misomodesub1, atsc3_frame_length_mode_t flmode, int flen, atsc3_papr_t paprmode, atsc3_l1_fec_mode_t l1bmode, atsc3_l1_fec_mode_t l1dmode);
+      static sptr make(atsc3_framesize_t framesizesub0, atsc3_code_rate_t ratesub0, atsc3_plp_fec_mode_t fecmodesub0, atsc3_constellation_t constellationsub0, atsc3_fftsize_t fftsizesub0, int numpayloadsymssub0, int numpreamblesyms, atsc3_guardinterval_t guardintervalsub0, atsc3_pilotpattern_t pilotpatternsub0, atsc3_scattered_pilot_boost_t pilotboostsub0, atsc3_first_sbs_t firstsbs, atsc3_frequency_interleaver_t fimodesub0, atsc3_time_interleaver_mode_t timodesub0, atsc3_time_interleaver_depth_t tidepthsub0, int tiblockssub0, int tifecblocksmaxsub0, int tifecblockssub0, int plpsizesub0, atsc3_lls_insertion_mode_t llsmodesub0, atsc3_reduced_carriers_t credsub0, atsc3_miso_t misomodesub0, atsc3_framesize_t framesizesub1, atsc3_code_rate_t ratesub1, atsc3_plp_fec_mode_t fecmodesub1, atsc3_constellation_t constellationsub1, atsc3_fftsize_t fftsizesub1, int numpayloadsymssub1, atsc3_guardinterval_t guardintervalsub1, atsc3_pilotpattern_t pilotpatternsub1, atsc3_scattered_pilot_boost_t pilotboostsub1, atsc3_frequency_interleaver_t fimodesub1, atsc3_time_interleaver_mode_t timodesub1, atsc3_time_interleaver_depth_t tidepthsub1, int tiblockssub1, int tifecblocksmaxsub1, int tifecblockssub1, int plpsizesub1, atsc3_lls_insertion_mode_t llsmodesub1, atsc3_reduced_carriers_t credsub1, atsc3_miso_t misomodesub1, atsc3_frame_length_mode_t flmode, int flen, atsc3_papr_t paprmode, atsc3_l1_fec_mode_t l1bmode, atsc3_l1_fec_mode_t l1dmode, atsc3_ti_address_mode_t tiaddress);
     };
 
   } // namespace atsc3
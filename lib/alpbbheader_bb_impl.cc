@@ -6,6 +6,8 @@
  */
 
 #include <gnuradio/io_signature.h>
+#include <chrono>
+#include <thread>
 #include "alpbbheader_bb_impl.h"
 #include "params.h"
 
@@ -14,6 +16,8 @@
 #define LLS_HEADER_LENGTH 4
 #define ALP_HEADER_LENGTH 2
 #define MPEG_PKT_LENGTH 188
+#define FRAME_POOL_DEPTH 8
+#define FRAME_WAIT_MS 100
 
 namespace gr {
   namespace atsc3 {
@@ -21,20 +25,20 @@ namespace gr {
     using input_type = unsigned char;
     using output_type = unsigned char;
     alpbbheader_bb::sptr
-    alpbbheader_bb::make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_lls_insertion_mode_t llsmode, atsc3_lls_service_count_t llscount)
+    alpbbheader_bb::make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_lls_insertion_mode_t llsmode, atsc3_lls_service_count_t llscount, atsc3_packed_mode_t packed)
     {
       return gnuradio::make_block_sptr<alpbbheader_bb_impl>(
-        framesize, rate, llsmode, llscount);
+        framesize, rate, llsmode, llscount, packed);
     }
 
 
     /*
      * The private constructor
      */
-    alpbbheader_bb_impl::alpbbheader_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_lls_insertion_mode_t llsmode, atsc3_lls_service_count_t llscount)
+    alpbbheader_bb_impl::alpbbheader_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_lls_insertion_mode_t llsmode, atsc3_lls_service_count_t llscount, atsc3_packed_mode_t packed)
       : gr::block("alpbbheader_bb",
               gr::io_signature::make(1, 1, sizeof(input_type)),
-              gr::io_signature::make(1, 1, sizeof(output_type)))
+              gr::io_signature::make(0, 1, sizeof(output_type)))
     {
       char lls[1024];
       int offset = 0;
@@ -97,7 +101,12 @@ namespace gr {
       lls_mode = llsmode;
       struct fec_params_t p = fec_params(framesize, rate);
       kbch = p.kbch;
-      set_output_multiple(kbch);
+      packed_mode = packed;
+      item_bits = (packed_mode == PACKED_ON) ? 8 : 1;
+      frame_items = kbch / item_bits;
+      set_output_multiple(frame_items);
+      frame_mode = FALSE;
+      message_port_register_out(pmt::mp("frames"));
       clock_gettime(CLOCK_TAI, &tai_last);
     }
 
@@ -108,18 +117,48 @@ namespace gr {
     {
     }
 
+    /*
+     * Without a connected output stream every baseband frame is
+     * published as a packed PDU from the frame pool on the "frames"
+     * port. The scheduler then offers input / relative rate items, so
+     * work is only called once the input holds the margin of a frame
+     * (more than Kbch / 2 bytes, as in general_work()). The pool has
+     * FRAME_POOL_DEPTH frames, when they are all in flight no input
+     * is consumed, so the downstream block sets the pace.
+     */
+    bool
+    alpbbheader_bb_impl::check_topology(int ninputs, int noutputs)
+    {
+      frame_mode = (noutputs == 0);
+      if (frame_mode) {
+        frames.init(kbch / 8, FRAME_POOL_DEPTH);
+        set_output_multiple(1);
+        set_relative_rate(1, kbch / 2 + 1);
+      }
+      else {
+        set_output_multiple(frame_items);
+        set_relative_rate(1, 1);
+      }
+      return true;
+    }
+
     void
     alpbbheader_bb_impl::forecast (int noutput_items, gr_vector_int &ninput_items_required)
     {
-      ninput_items_required[0] = noutput_items / 8;
+      ninput_items_required[0] = (noutput_items * item_bits) / 8;
     }
 
-    void
+    int
     alpbbheader_bb_impl::send_bits(unsigned char b, unsigned char *out)
     {
+      if (packed_mode == PACKED_ON || frame_mode) {
+        *out = b;
+        return 1;
+      }
       for (int n = 7; n >= 0; n--) {
         *out++ = b & (1 << n) ? 1 : 0;
       }
+      return 8;
     }
 
     int
@@ -204,7 +243,7 @@ namespace gr {
       udp_ptr->check = ~csum;
     }
 
-#define sendbits(bits, out) send_bits(bits, out); out +=8; produced +=8;
+#define sendbits(bits, out) sent = send_bits(bits, out); out += sent; produced += sent;
 
     int
     alpbbheader_bb_impl::general_work (int noutput_items,
@@ -213,7 +252,7 @@ namespace gr {
                        gr_vector_void_star &output_items)
     {
       auto in = static_cast<const input_type*>(input_items[0]);
-      auto out = static_cast<output_type*>(output_items[0]);
+      auto out = frame_mode ? nullptr : static_cast<output_type*>(output_items[0]);
       int consumed = 0;
       int produced = 0;
       unsigned char bits;
@@ -221,9 +260,25 @@ namespace gr {
       long long delta;
       int pcount;
       int stuffing, offset;
+      int sent;
+      int lls_frame;
 
-      if (ninput_items[0] > (noutput_items / 2)) {
-        for (int i = 0; i < noutput_items; i += kbch) {
+      /* Without outputs, size frame mode by the input margin below. */
+      if (frame_mode) {
+        noutput_items = ((ninput_items[0] - 1) / (kbch / 2)) * frame_items;
+      }
+      if (ninput_items[0] > ((noutput_items * item_bits) / 2)) {
+        for (int i = 0; i < noutput_items; i += frame_items) {
+          if (frame_mode) {
+            /* With every frame in flight, stop consuming until fec_encoder_bb frees one. */
+            for (int wait = 0; (out = frames.acquire()) == nullptr && produced == 0 && wait < FRAME_WAIT_MS; wait++) {
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            if (out == nullptr) {
+              break;
+            }
+          }
+          lls_frame = FALSE;
           pcount = 2;
           clock_gettime(CLOCK_TAI, &tai);
           if (tai.tv_sec > tai_last.tv_sec) {
@@ -305,11 +360,16 @@ namespace gr {
               lls_count--;
               if (lls_count == 0) {
                 lls_send = FALSE;
-                const uint64_t tagoffset = this->nitems_written(0);
-                const uint64_t tagvalue = 0;
-                pmt::pmt_t key = pmt::string_to_symbol("lls");
-                pmt::pmt_t value = pmt::from_uint64(tagvalue);
-                this->add_item_tag(0, tagoffset, key, value);
+                if (frame_mode) {
+                  lls_frame = TRUE;
+                }
+                else {
+                  const uint64_t tagoffset = this->nitems_written(0);
+                  const uint64_t tagvalue = 0;
+                  pmt::pmt_t key = pmt::string_to_symbol("lls");
+                  pmt::pmt_t value = pmt::from_uint64(tagvalue);
+                  this->add_item_tag(0, tagoffset, key, value);
+                }
               }
               bits = llstemp[lls_index++];
               sendbits(bits, out);
@@ -394,9 +454,12 @@ skip:
             }
           }
           bbcount += pcount - (kbch / 8);
+          if (frame_mode) {
+            message_port_pub(pmt::mp("frames"), frames.pdu(lls_frame == TRUE));
+          }
         }
       }
-      if (produced != noutput_items) {
+      if (!frame_mode && produced != noutput_items) {
         if (produced != 0) {
           printf("produced = %d, expected = %d\n", produced, noutput_items);
         }
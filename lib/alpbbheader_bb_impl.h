@@ -1,6 +1,6 @@
 /* -*- c++ -*- */
 /*
- * Copyright 2021-2023 Ron Economos.
+ * Copyright 2021-2025 Ron Economos.
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
@@ -16,6 +16,7 @@
 #include <netinet/ip.h>
 #include <netinet/udp.h>
 #include "atsc3_defines.h"
+#include "frame_pool.h"
 
 
 namespace gr {
@@ -25,6 +26,9 @@ namespace gr {
     {
      private:
       int kbch;
+      int packed_mode;
+      int item_bits;
+      int frame_items;
       int count;
       int bbcount;
       int packets;
@@ -37,6 +41,8 @@ namespace gr {
       int lls_count;
       int lls_index;
       int remainder;
+      int frame_mode;
+      frame_pool frames;
       struct timespec tai_last;
       unsigned char llsgz[1024];
       unsigned char llstemp[1024];
@@ -45,7 +51,7 @@ namespace gr {
       unsigned short identification;
       unsigned char src_addr[sizeof(in_addr)];
       unsigned char dst_addr[sizeof(in_addr)];
-      void send_bits(unsigned char b, unsigned char *out);
+      int send_bits(unsigned char b, unsigned char *out);
       int checksum(unsigned short *, int, int);
       void send_lls(unsigned char *out);
 
@@ -59,9 +65,10 @@ namespace gr {
       const static char SLT_end[];
 
      public:
-      alpbbheader_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_lls_insertion_mode_t llsmode, atsc3_lls_service_count_t llscount);
+      alpbbheader_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_lls_insertion_mode_t llsmode, atsc3_lls_service_count_t llscount, atsc3_packed_mode_t packed);
       ~alpbbheader_bb_impl();
 
+      bool check_topology(int ninputs, int noutputs);
       void forecast (int noutput_items, gr_vector_int &ninput_items_required);
 
       int general_work(int noutput_items,
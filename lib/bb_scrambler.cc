@@ -0,0 +1,162 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstdint>
+#include <cstring>
+#include "bb_scrambler.h"
+#include "atsc3_defines.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BB_SCRAMBLER_X86
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BB_SCRAMBLER_NEON
+#endif
+
+namespace gr {
+  namespace atsc3 {
+
+    /* Packed frames need not be a multiple of 8 bytes. */
+    static void
+    xor_generic(const unsigned char* in, const unsigned char* prbs, int len, unsigned char* out)
+    {
+      uint64_t word, mask;
+      int i = 0;
+
+      for (; i + 8 <= len; i += 8) {
+        memcpy(&word, &in[i], sizeof(word));
+        memcpy(&mask, &prbs[i], sizeof(mask));
+        word ^= mask;
+        memcpy(&out[i], &word, sizeof(word));
+      }
+      for (; i < len; i++) {
+        out[i] = in[i] ^ prbs[i];
+      }
+    }
+
+#ifdef BB_SCRAMBLER_X86
+    __attribute__((target("avx2"))) static void
+    xor_avx2(const unsigned char* in, const unsigned char* prbs, int len, unsigned char* out)
+    {
+      int i = 0;
+
+      for (; i + 128 <= len; i += 128) {
+        const __m256i a0 = _mm256_loadu_si256((const __m256i*)&in[i]);
+        const __m256i a1 = _mm256_loadu_si256((const __m256i*)&in[i + 32]);
+        const __m256i a2 = _mm256_loadu_si256((const __m256i*)&in[i + 64]);
+        const __m256i a3 = _mm256_loadu_si256((const __m256i*)&in[i + 96]);
+        _mm256_storeu_si256((__m256i*)&out[i], _mm256_xor_si256(a0, _mm256_loadu_si256((const __m256i*)&prbs[i])));
+        _mm256_storeu_si256((__m256i*)&out[i + 32], _mm256_xor_si256(a1, _mm256_loadu_si256((const __m256i*)&prbs[i + 32])));
+        _mm256_storeu_si256((__m256i*)&out[i + 64], _mm256_xor_si256(a2, _mm256_loadu_si256((const __m256i*)&prbs[i + 64])));
+        _mm256_storeu_si256((__m256i*)&out[i + 96], _mm256_xor_si256(a3, _mm256_loadu_si256((const __m256i*)&prbs[i + 96])));
+      }
+      for (; i + 32 <= len; i += 32) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)&in[i]);
+        _mm256_storeu_si256((__m256i*)&out[i], _mm256_xor_si256(a, _mm256_loadu_si256((const __m256i*)&prbs[i])));
+      }
+      xor_generic(&in[i], &prbs[i], len - i, &out[i]);
+    }
+
+    __attribute__((target("avx512f"))) static void
+    xor_avx512(const unsigned char* in, const unsigned char* prbs, int len, unsigned char* out)
+    {
+      int i = 0;
+
+      for (; i + 256 <= len; i += 256) {
+        const __m512i a0 = _mm512_loadu_si512(&in[i]);
+        const __m512i a1 = _mm512_loadu_si512(&in[i + 64]);
+        const __m512i a2 = _mm512_loadu_si512(&in[i + 128]);
+        const __m512i a3 = _mm512_loadu_si512(&in[i + 192]);
+        _mm512_storeu_si512(&out[i], _mm512_xor_si512(a0, _mm512_loadu_si512(&prbs[i])));
+        _mm512_storeu_si512(&out[i + 64], _mm512_xor_si512(a1, _mm512_loadu_si512(&prbs[i + 64])));
+        _mm512_storeu_si512(&out[i + 128], _mm512_xor_si512(a2, _mm512_loadu_si512(&prbs[i + 128])));
+        _mm512_storeu_si512(&out[i + 192], _mm512_xor_si512(a3, _mm512_loadu_si512(&prbs[i + 192])));
+      }
+      for (; i + 64 <= len; i += 64) {
+        const __m512i a = _mm512_loadu_si512(&in[i]);
+        _mm512_storeu_si512(&out[i], _mm512_xor_si512(a, _mm512_loadu_si512(&prbs[i])));
+      }
+      xor_generic(&in[i], &prbs[i], len - i, &out[i]);
+    }
+#endif
+
+#ifdef BB_SCRAMBLER_NEON
+    static void
+    xor_neon(const unsigned char* in, const unsigned char* prbs, int len, unsigned char* out)
+    {
+      int i = 0;
+
+      for (; i + 64 <= len; i += 64) {
+        const uint8x16_t a0 = vld1q_u8(&in[i]);
+        const uint8x16_t a1 = vld1q_u8(&in[i + 16]);
+        const uint8x16_t a2 = vld1q_u8(&in[i + 32]);
+        const uint8x16_t a3 = vld1q_u8(&in[i + 48]);
+        vst1q_u8(&out[i], veorq_u8(a0, vld1q_u8(&prbs[i])));
+        vst1q_u8(&out[i + 16], veorq_u8(a1, vld1q_u8(&prbs[i + 16])));
+        vst1q_u8(&out[i + 32], veorq_u8(a2, vld1q_u8(&prbs[i + 32])));
+        vst1q_u8(&out[i + 48], veorq_u8(a3, vld1q_u8(&prbs[i + 48])));
+      }
+      for (; i + 16 <= len; i += 16) {
+        vst1q_u8(&out[i], veorq_u8(vld1q_u8(&in[i]), vld1q_u8(&prbs[i])));
+      }
+      xor_generic(&in[i], &prbs[i], len - i, &out[i]);
+    }
+#endif
+
+    bb_scrambler::bb_scrambler()
+      : kernel_name("generic"),
+        items(0),
+        xor_kernel(xor_generic)
+    {
+#ifdef BB_SCRAMBLER_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f")) {
+        xor_kernel = xor_avx512;
+        kernel_name = "avx512";
+      }
+      else if (__builtin_cpu_supports("avx2")) {
+        xor_kernel = xor_avx2;
+        kernel_name = "avx2";
+      }
+#endif
+#ifdef BB_SCRAMBLER_NEON
+      xor_kernel = xor_neon;
+      kernel_name = "neon";
+#endif
+    }
+
+    void
+    bb_scrambler::init(int kbch, atsc3_packed_mode_t packed)
+    {
+      int sr = 0x18f;
+      int b, byte;
+
+      items = (packed == PACKED_ON) ? kbch / 8 : kbch;
+      sequence.resize(items);
+      for (int i = 0; i < items;) {
+        byte = ((sr & 0x4) << 5) | ((sr & 0x8) << 3) | ((sr & 0x10) << 1) | \
+               ((sr & 0x20) >> 1) | ((sr & 0x200) >> 6) | ((sr & 0x1000) >> 10) | \
+               ((sr & 0x2000) >> 12) | ((sr & 0x8000) >> 15);
+        if (packed == PACKED_ON) {
+          sequence[i++] = byte;
+        }
+        else {
+          for (int n = 7; n >= 0; n--) {
+            sequence[i++] = byte & (1 << n) ? 1 : 0;
+          }
+        }
+        b = sr & 1;
+        sr >>= 1;
+        if (b) {
+          sr ^= POLYNOMIAL;
+        }
+      }
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
@@ -0,0 +1,58 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_BB_SCRAMBLER_H
+#define INCLUDED_ATSC3_BB_SCRAMBLER_H
+
+#include <atsc3/atsc3_config.h>
+#include <string>
+#include <vector>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * A/322 baseband scrambler, PRBS 1 + x^14 + x^15 initialized to
+     * 0x18f, over the kbch bits of a baseband frame.
+     *
+     * The sequence is precomputed once for the whole frame, packed
+     * (kbch / 8 bytes, MSB first) or unpacked (one bit per byte), so
+     * scrambling is a single XOR pass. The XOR runs 64, 32 or 16 bytes
+     * at a time with AVX-512, AVX2 or NEON where available, selected
+     * at runtime.
+     */
+    class bb_scrambler
+    {
+     public:
+      bb_scrambler();
+
+      void init(int kbch, atsc3_packed_mode_t packed);
+
+      /* Bytes per baseband frame, kbch / 8 packed or kbch unpacked. */
+      int frame_items() const { return items; }
+
+      /* in and out may be the same buffer (in place). */
+      void scramble(const unsigned char* in, unsigned char* out) const
+      {
+        xor_kernel(in, sequence.data(), items, out);
+      }
+
+      const std::string& name() const { return kernel_name; }
+
+     private:
+      typedef void (*xor_kernel_t)(const unsigned char* in, const unsigned char* prbs, int len, unsigned char* out);
+
+      std::string kernel_name;
+      int items;
+      std::vector<unsigned char> sequence;
+      xor_kernel_t xor_kernel;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_BB_SCRAMBLER_H */
@@ -1,6 +1,6 @@
 /* -*- c++ -*- */
 /*
- * Copyright 2021 Ron Economos.
+ * Copyright 2021-2025 Ron Economos.
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
@@ -15,22 +15,21 @@ namespace gr {
     using input_type = unsigned char;
     using output_type = unsigned char;
     bbscrambler_bb::sptr
-    bbscrambler_bb::make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode)
+    bbscrambler_bb::make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed)
     {
       return gnuradio::make_block_sptr<bbscrambler_bb_impl>(
-        framesize, rate, fecmode);
+        framesize, rate, fecmode, packed);
     }
 
 
     /*
      * The private constructor
      */
-    bbscrambler_bb_impl::bbscrambler_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode)
+    bbscrambler_bb_impl::bbscrambler_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed)
       : gr::sync_block("bbscrambler_bb",
               gr::io_signature::make(1, 1, sizeof(input_type)),
               gr::io_signature::make(1, 1, sizeof(output_type)))
     {
-      int nbch = 0;
       int num_fec_bits = 0;
 
       switch (fecmode) {
@@ -53,10 +52,10 @@ namespace gr {
           break;
       }
       struct fec_params_t p = fec_params(framesize, rate);
-      nbch = p.nbch;
-      kbch = nbch - num_fec_bits;
-      init_bb_randomizer();
-      set_output_multiple(kbch);
+      scrambler.init(p.nbch - num_fec_bits, packed);
+      frame_items = scrambler.frame_items();
+      GR_LOG_INFO(d_logger, "Scrambler kernel: " + scrambler.name());
+      set_output_multiple(frame_items);
     }
 
     /*
@@ -66,40 +65,18 @@ namespace gr {
     {
     }
 
-    void
-    bbscrambler_bb_impl::init_bb_randomizer(void)
-    {
-      int sr = 0x18f;
-      int b, packed;
-
-      for (int i = 0; i < FRAME_SIZE_NORMAL;) {
-        packed = ((sr & 0x4) << 5) | ((sr & 0x8) << 3) | ((sr & 0x10) << 1) | \
-                 ((sr & 0x20) >> 1) | ((sr & 0x200) >> 6) | ((sr & 0x1000) >> 10) | \
-                 ((sr & 0x2000) >> 12) | ((sr & 0x8000) >> 15);
-        for (int n = 7; n >= 0; n--) {
-          bb_randomize[i++] = packed & (1 << n) ? 1 : 0;
-        }
-        b = sr & 1;
-        sr >>= 1;
-        if (b) {
-          sr ^= POLYNOMIAL;
-        }
-      }
-      bb_randomize64 = (uint64_t*)&bb_randomize[0];
-    }
-
     int
     bbscrambler_bb_impl::work(int noutput_items,
         gr_vector_const_void_star &input_items,
         gr_vector_void_star &output_items)
     {
-      auto in = static_cast<const uint64_t*>(input_items[0]);
-      auto out = static_cast<uint64_t*>(output_items[0]);
+      auto in = static_cast<const input_type*>(input_items[0]);
+      auto out = static_cast<output_type*>(output_items[0]);
 
-      for (int i = 0; i < noutput_items; i += kbch) {
-        for (int j = 0; j < kbch / 8; j++) {
-          *out++ = *in++ ^ bb_randomize64[j];
-        }
+      for (int i = 0; i < noutput_items; i += frame_items) {
+        scrambler.scramble(in, out);
+        in += frame_items;
+        out += frame_items;
       }
 
       // Tell runtime system how many output items we produced.
@@ -1,6 +1,6 @@
 /* -*- c++ -*- */
 /*
- * Copyright 2021 Ron Economos.
+ * Copyright 2021-2025 Ron Economos.
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
@@ -9,7 +9,7 @@
 #define INCLUDED_ATSC3_BBSCRAMBLER_BB_IMPL_H
 
 #include <atsc3/bbscrambler_bb.h>
-#include "atsc3_defines.h"
+#include "bb_scrambler.h"
 
 namespace gr {
   namespace atsc3 {
@@ -17,13 +17,11 @@ namespace gr {
     class bbscrambler_bb_impl : public bbscrambler_bb
     {
      private:
-      int kbch;
-      __GR_ATTR_ALIGNED(8) unsigned char bb_randomize[FRAME_SIZE_NORMAL];
-      uint64_t* bb_randomize64;
-      void init_bb_randomizer(void);
+      int frame_items;
+      bb_scrambler scrambler;
 
      public:
-      bbscrambler_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode);
+      bbscrambler_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed);
       ~bbscrambler_bb_impl();
 
       int work(
@@ -10,7 +10,8 @@
 
 #include <atsc3/bch_bb.h>
 #include "atsc3_defines.h"
-#include <bitset>
+#include "bch_encoder.h"
+#include "crc32_encoder.h"
 
 namespace gr {
   namespace atsc3 {
@@ -23,19 +24,14 @@ namespace gr {
       int frame_size;
       int plp_fec_mode;
       int num_fec_bits;
-      unsigned int crc32_table[256];
-
-      std::bitset<MAX_BCH_PARITY_BITS> crc_table[256];
-      unsigned int num_parity_bits;
-      std::bitset<MAX_BCH_PARITY_BITS> polynome;
-
-      void calculate_crc_table();
-      int poly_mult(const int*, int, const int*, int, int*);
-      void bch_poly_build_tables(void);
-      void crc32_init(void);
+      int packed_mode;
+      int kbch_items;
+      int nbch_items;
+      bch_encoder bch;
+      crc32_encoder crc32;
 
      public:
-      bch_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode);
+      bch_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed);
       ~bch_bb_impl();
 
       void forecast (int noutput_items, gr_vector_int &ninput_items_required);
@@ -0,0 +1,211 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstring>
+#include "bch_encoder.h"
+#include "bit_pack.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Polynomial calculation routines
+     * multiply polynomials
+     */
+
+    static int
+    poly_mult(const int* ina, int lena, const int* inb, int lenb, int* out)
+    {
+      memset(out, 0, sizeof(int) * (lena + lenb));
+
+      for (int i = 0; i < lena; i++) {
+        for (int j = 0; j < lenb; j++) {
+          if (ina[i] * inb[j] > 0) {
+            out[i + j]++; // count number of terms for this pwr of x
+          }
+        }
+      }
+      int max = 0;
+      for (int i = 0; i < lena + lenb; i++) {
+        out[i] = out[i] & 1; // If even ignore the term
+        if (out[i]) {
+          max = i;
+        }
+      }
+      // return the size of array to house the result.
+      return max + 1;
+    }
+
+    bch_encoder::bch_encoder(atsc3_framesize_t framesize)
+    {
+      // Normal polynomials
+      const int polyn01[] = { 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+      const int polyn02[] = { 1, 1, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1 };
+      const int polyn03[] = { 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1 };
+      const int polyn04[] = { 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 1 };
+      const int polyn05[] = { 1, 1, 1, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 1 };
+      const int polyn06[] = { 1, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1 };
+      const int polyn07[] = { 1, 0, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 1, 1 };
+      const int polyn08[] = { 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 0, 1 };
+      const int polyn09[] = { 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1 };
+      const int polyn10[] = { 1, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 1, 1, 1, 0, 1 };
+      const int polyn11[] = { 1, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 1 };
+      const int polyn12[] = { 1, 1, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 1 };
+
+      // Short polynomials
+      const int polys01[] = { 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+      const int polys02[] = { 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1 };
+      const int polys03[] = { 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1 };
+      const int polys04[] = { 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 0, 1, 0, 1 };
+      const int polys05[] = { 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 0, 1, 0, 1, 1 };
+      const int polys06[] = { 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1 };
+      const int polys07[] = { 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1 };
+      const int polys08[] = { 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 1 };
+      const int polys09[] = { 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1 };
+      const int polys10[] = { 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1 };
+      const int polys11[] = { 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1 };
+      const int polys12[] = { 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 1, 1 };
+
+      int len;
+      int polyout[2][200];
+      uint64_t polynome[3] = {0, 0, 0};
+
+      if (framesize == FECFRAME_NORMAL) {
+        num_parity_bits = 192;
+        len = poly_mult(polyn01, 17, polyn02, 17, polyout[0]);
+        len = poly_mult(polyn03, 17, polyout[0], len, polyout[1]);
+        len = poly_mult(polyn04, 17, polyout[1], len, polyout[0]);
+        len = poly_mult(polyn05, 17, polyout[0], len, polyout[1]);
+        len = poly_mult(polyn06, 17, polyout[1], len, polyout[0]);
+        len = poly_mult(polyn07, 17, polyout[0], len, polyout[1]);
+        len = poly_mult(polyn08, 17, polyout[1], len, polyout[0]);
+        len = poly_mult(polyn09, 17, polyout[0], len, polyout[1]);
+        len = poly_mult(polyn10, 17, polyout[1], len, polyout[0]);
+        len = poly_mult(polyn11, 17, polyout[0], len, polyout[1]);
+        len = poly_mult(polyn12, 17, polyout[1], len, polyout[0]);
+      }
+      else {
+        num_parity_bits = 168;
+        len = poly_mult(polys01, 15, polys02, 15, polyout[0]);
+        len = poly_mult(polys03, 15, polyout[0], len, polyout[1]);
+        len = poly_mult(polys04, 15, polyout[1], len, polyout[0]);
+        len = poly_mult(polys05, 15, polyout[0], len, polyout[1]);
+        len = poly_mult(polys06, 15, polyout[1], len, polyout[0]);
+        len = poly_mult(polys07, 15, polyout[0], len, polyout[1]);
+        len = poly_mult(polys08, 15, polyout[1], len, polyout[0]);
+        len = poly_mult(polys09, 15, polyout[0], len, polyout[1]);
+        len = poly_mult(polys10, 15, polyout[1], len, polyout[0]);
+        len = poly_mult(polys11, 15, polyout[0], len, polyout[1]);
+        len = poly_mult(polys12, 15, polyout[1], len, polyout[0]);
+      }
+      // drop the x^n term and align the polynomial to bit 191
+      for (int i = 0; i < num_parity_bits; i++) {
+        if (polyout[0][i]) {
+          const int bit = i + (192 - num_parity_bits);
+          polynome[2 - (bit / 64)] |= uint64_t(1) << (bit % 64);
+        }
+      }
+      build_tables(polynome);
+    }
+
+/*
+ * Table k is the remainder of x * 2^(n + 8 * (7 - k)), where x is
+ * byte k (MSB first) of a 64-bit word, computed bit by bit.
+ */
+
+    void
+    bch_encoder::build_tables(const uint64_t* polynome)
+    {
+      table.resize(8 * 256 * 3);
+      for (int k = 0; k < 8; k++) {
+        for (int x = 0; x < 256; x++) {
+          uint64_t r[3] = {uint64_t(x) << 56, 0, 0};
+          for (int bit = 0; bit < 8 + (8 * (7 - k)); bit++) {
+            const uint64_t feedback = 0 - (r[0] >> 63);
+            r[0] = (r[0] << 1) | (r[1] >> 63);
+            r[1] = (r[1] << 1) | (r[2] >> 63);
+            r[2] = r[2] << 1;
+            r[0] ^= polynome[0] & feedback;
+            r[1] ^= polynome[1] & feedback;
+            r[2] ^= polynome[2] & feedback;
+          }
+          uint64_t* t = &table[((k * 256) + x) * 3];
+          t[0] = r[0];
+          t[1] = r[1];
+          t[2] = r[2];
+        }
+      }
+    }
+
+    inline void
+    bch_encoder::update_word(uint64_t* r, uint64_t word) const
+    {
+      const uint64_t x = r[0] ^ word;
+      r[0] = r[1];
+      r[1] = r[2];
+      r[2] = 0;
+      for (int k = 0; k < 8; k++) {
+        const uint64_t* t = &table[((k * 256) + ((x >> (56 - (8 * k))) & 0xff)) * 3];
+        r[0] ^= t[0];
+        r[1] ^= t[1];
+        r[2] ^= t[2];
+      }
+    }
+
+    inline void
+    bch_encoder::update_byte(uint64_t* r, unsigned char byte) const
+    {
+      const uint64_t* t = &table[((7 * 256) + ((r[0] >> 56) ^ byte)) * 3];
+      r[0] = ((r[0] << 8) | (r[1] >> 56)) ^ t[0];
+      r[1] = ((r[1] << 8) | (r[2] >> 56)) ^ t[1];
+      r[2] = (r[2] << 8) ^ t[2];
+    }
+
+    void
+    bch_encoder::encode_bits(const unsigned char* bits, int len, unsigned char* parity) const
+    {
+      uint64_t r[3] = {0, 0, 0};
+      int i = 0;
+
+      for (; i + 64 <= len; i += 64) {
+        uint64_t word = 0;
+        for (int j = 0; j < 64; j += 8) {
+          word = (word << 8) | pack_bits8(&bits[i + j]);
+        }
+        update_word(r, word);
+      }
+      for (; i + 8 <= len; i += 8) {
+        update_byte(r, pack_bits8(&bits[i]));
+      }
+      for (int n = 0; n < num_parity_bits; n++) {
+        parity[n] = (r[n / 64] >> (63 - (n % 64))) & 0x1;
+      }
+    }
+
+    void
+    bch_encoder::encode_bytes(const unsigned char* data, int len, unsigned char* parity) const
+    {
+      uint64_t r[3] = {0, 0, 0};
+      int i = 0;
+
+      for (; i + 8 <= len; i += 8) {
+        uint64_t word = 0;
+        for (int j = 0; j < 8; j++) {
+          word = (word << 8) | data[i + j];
+        }
+        update_word(r, word);
+      }
+      for (; i < len; i++) {
+        update_byte(r, data[i]);
+      }
+      for (int n = 0; n < num_parity_bits / 8; n++) {
+        parity[n] = r[n / 8] >> (56 - ((n % 8) * 8));
+      }
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
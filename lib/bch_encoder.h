@@ -0,0 +1,58 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_BCH_ENCODER_H
+#define INCLUDED_ATSC3_BCH_ENCODER_H
+
+#include <cstdint>
+#include <vector>
+#include <atsc3/atsc3_config.h>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * A/322 BCH outer encoder, 192 parity bits for normal and 168 for
+     * short FECFRAMEs.
+     *
+     * The remainder is kept in three 64-bit words, MSB aligned at bit
+     * 191, so both codes share the same word shifts. The message is
+     * divided 64 bits at a time with eight 256-entry tables (slice-by-8),
+     * table k holding the remainder of byte k of the word.
+     */
+    class bch_encoder
+    {
+     public:
+      bch_encoder(atsc3_framesize_t framesize);
+
+      int parity_bits() const { return num_parity_bits; }
+
+      /*
+       * bits holds one message bit per byte (0 or 1), len is a multiple
+       * of 8. The parity is written to parity, one bit per byte.
+       */
+      void encode_bits(const unsigned char* bits, int len, unsigned char* parity) const;
+
+      /*
+       * data holds len MSB first packed message bytes. The parity is
+       * written to parity packed, parity_bits() / 8 bytes.
+       */
+      void encode_bytes(const unsigned char* data, int len, unsigned char* parity) const;
+
+     private:
+      int num_parity_bits;
+      std::vector<uint64_t> table; // [8][256][3]
+
+      void build_tables(const uint64_t* polynome);
+      void update_word(uint64_t* r, uint64_t word) const;
+      void update_byte(uint64_t* r, unsigned char byte) const;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_BCH_ENCODER_H */
@@ -0,0 +1,119 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include "bicm_bc_impl.h"
+#include "constellations.h"
+#include "params.h"
+
+#define CELL_BLOCK 512
+
+namespace gr {
+  namespace atsc3 {
+
+    using input_type = unsigned char;
+    using output_type = gr_complex;
+    bicm_bc::sptr
+    bicm_bc::make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_constellation_t constellation, atsc3_packed_mode_t packed)
+    {
+      return gnuradio::make_block_sptr<bicm_bc_impl>(
+        framesize, rate, constellation, packed);
+    }
+
+
+    /*
+     * The private constructor
+     */
+    bicm_bc_impl::bicm_bc_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_constellation_t constellation, atsc3_packed_mode_t packed)
+      : gr::block("bicm_bc",
+              gr::io_signature::make(1, 1, sizeof(input_type)),
+              gr::io_signature::make(1, 1, sizeof(output_type))),
+        interleaver(framesize, rate, constellation, packed)
+    {
+      struct fec_params_t p = fec_params(framesize, rate);
+      points = constellation_points(constellation, p.rate_index, expanded);
+      mapper.init(constellation_size(constellation));
+      mod = interleaver.bits_per_cell();
+      packed_items = interleaver.cells();
+      item_bits = (packed == PACKED_ON) ? 8 : 1;
+      set_output_multiple(packed_items);
+      GR_LOG_INFO(d_logger, "BICM interleaver kernel: " + interleaver.name() + ", mapper kernel: " + mapper.name());
+      set_tag_propagation_policy(TPP_DONT);
+    }
+
+    /*
+     * Our virtual destructor.
+     */
+    bicm_bc_impl::~bicm_bc_impl()
+    {
+    }
+
+    void
+    bicm_bc_impl::forecast (int noutput_items, gr_vector_int &ninput_items_required)
+    {
+      ninput_items_required[0] = (noutput_items * mod) / item_bits;
+    }
+
+/*
+ * The cells of a frame are formed and mapped CELL_BLOCK at a time,
+ * so the cell indices never leave the L1 cache.
+ */
+
+    void
+    bicm_bc_impl::map_frame(const input_type *in, output_type *out)
+    {
+      unsigned short cells[CELL_BLOCK];
+
+      interleaver.load(in);
+      for (int j = 0; j < packed_items; j += CELL_BLOCK) {
+        const int count = std::min(CELL_BLOCK, packed_items - j);
+        interleaver.form_cells(j, count, cells);
+        mapper.map(cells, count, points, &out[j]);
+      }
+    }
+
+    int
+    bicm_bc_impl::general_work (int noutput_items,
+                       gr_vector_int &ninput_items,
+                       gr_vector_const_void_star &input_items,
+                       gr_vector_void_star &output_items)
+    {
+      auto in = static_cast<const input_type*>(input_items[0]);
+      auto out = static_cast<output_type*>(output_items[0]);
+      const int frame_items = interleaver.frame_items();
+      int consumed = 0;
+
+      std::vector<tag_t> tags;
+      const uint64_t nread = this->nitems_read(0); //number of items read on port 0
+
+      // Read all tags on the input buffer
+      this->get_tags_in_range(tags, 0, nread, nread + ((noutput_items * mod) / item_bits), pmt::string_to_symbol("lls"));
+      if ((int)tags.size()) {
+        const uint64_t tagoffset = this->nitems_written(0);
+        const uint64_t tagvalue = tagoffset + noutput_items;
+        pmt::pmt_t key = pmt::string_to_symbol("lls");
+        pmt::pmt_t value = pmt::from_uint64(tagvalue);
+        this->add_item_tag(0, tagoffset, key, value);
+      }
+
+      for (int i = 0; i < noutput_items; i += packed_items) {
+        map_frame(in, &out[i]);
+        in += frame_items;
+        consumed += frame_items;
+      }
+
+      // Tell runtime system how many input items we consumed on
+      // each input stream.
+      consume_each (consumed);
+
+      // Tell runtime system how many output items we produced.
+      return noutput_items;
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
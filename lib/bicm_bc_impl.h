@@ -0,0 +1,47 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_BICM_BC_IMPL_H
+#define INCLUDED_ATSC3_BICM_BC_IMPL_H
+
+#include <atsc3/bicm_bc.h>
+#include <vector>
+#include "bit_interleaver.h"
+#include "mapper_kernels.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    class bicm_bc_impl : public bicm_bc
+    {
+     private:
+      int mod;
+      int packed_items;
+      int item_bits;
+      bit_interleaver interleaver;
+      const gr_complex *points;
+      std::vector<gr_complex> expanded;
+      mapper_kernels mapper;
+      void map_frame(const unsigned char *in, gr_complex *out);
+
+     public:
+      bicm_bc_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_constellation_t constellation, atsc3_packed_mode_t packed);
+      ~bicm_bc_impl();
+
+      void forecast (int noutput_items, gr_vector_int &ninput_items_required);
+
+      int general_work(int noutput_items,
+           gr_vector_int &ninput_items,
+           gr_vector_const_void_star &input_items,
+           gr_vector_void_star &output_items);
+
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_BICM_BC_IMPL_H */
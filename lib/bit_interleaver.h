@@ -0,0 +1,205 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_BIT_INTERLEAVER_H
+#define INCLUDED_ATSC3_BIT_INTERLEAVER_H
+
+#include <atsc3/atsc3_config.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "atsc3_defines.h"
+#include "interleaver_kernels.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * A/322 bit interleaver (parity, group-wise and block interleaver)
+     * and cell formation for one frame size, code rate and constellation.
+     *
+     * A frame is loaded once, then cells can be formed in one call or in
+     * consecutive ranges, so a caller can map each range to constellation
+     * points while it is still in cache.
+     */
+    class bit_interleaver
+    {
+     public:
+      bit_interleaver(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_constellation_t constellation, atsc3_packed_mode_t packed);
+
+      int cells() const { return packed_items; }
+      int bits_per_cell() const { return mod; }
+      /* Input items per frame, bits or packed bytes. */
+      int frame_items() const { return frame_size / item_bits; }
+
+      void load(const unsigned char *in);
+      /* Cells first to first + count - 1 of the loaded frame. */
+      void form_cells(int first, int count, unsigned short *out) const;
+      void interleave(const unsigned char *in, unsigned short *out)
+      {
+        load(in);
+        form_cells(0, packed_items, out);
+      }
+
+      const std::string& name() const { return kernels.name(); }
+
+     private:
+      int frame_size;
+      int group_size;
+      int ldpc_type;
+      int block_type;
+      int nbch;
+      int q_val;
+      int mod;
+      int packed_items;
+      int nr2;
+      int npart2;
+      int packed_mode;
+      int item_bits;
+      int plane_stride;
+      std::vector<uint16_t> permutation; // codeword bit of each cell bit, plane-major
+      std::vector<unsigned char> frame; // input frame, padded for the kernel over-read
+      interleaver_kernels kernels;
+      void init_permutation(void);
+
+      const int *group_table;
+
+      const static int group_tab_2_15N_QPSK[180];
+      const static int group_tab_3_15N_QPSK[180];
+      const static int group_tab_4_15N_QPSK[180];
+      const static int group_tab_5_15N_QPSK[180];
+      const static int group_tab_6_15N_QPSK[180];
+      const static int group_tab_7_15N_QPSK[180];
+      const static int group_tab_8_15N_QPSK[180];
+      const static int group_tab_9_15N_QPSK[180];
+      const static int group_tab_10_15N_QPSK[180];
+      const static int group_tab_11_15N_QPSK[180];
+      const static int group_tab_12_15N_QPSK[180];
+      const static int group_tab_13_15N_QPSK[180];
+
+      const static int group_tab_2_15S_QPSK[45];
+      const static int group_tab_3_15S_QPSK[45];
+      const static int group_tab_4_15S_QPSK[45];
+      const static int group_tab_5_15S_QPSK[45];
+      const static int group_tab_6_15S_QPSK[45];
+      const static int group_tab_7_15S_QPSK[45];
+      const static int group_tab_8_15S_QPSK[45];
+      const static int group_tab_9_15S_QPSK[45];
+      const static int group_tab_10_15S_QPSK[45];
+      const static int group_tab_11_15S_QPSK[45];
+      const static int group_tab_12_15S_QPSK[45];
+      const static int group_tab_13_15S_QPSK[45];
+
+      const static int group_tab_2_15N_16QAM[180];
+      const static int group_tab_3_15N_16QAM[180];
+      const static int group_tab_4_15N_16QAM[180];
+      const static int group_tab_5_15N_16QAM[180];
+      const static int group_tab_6_15N_16QAM[180];
+      const static int group_tab_7_15N_16QAM[180];
+      const static int group_tab_8_15N_16QAM[180];
+      const static int group_tab_9_15N_16QAM[180];
+      const static int group_tab_10_15N_16QAM[180];
+      const static int group_tab_11_15N_16QAM[180];
+      const static int group_tab_12_15N_16QAM[180];
+      const static int group_tab_13_15N_16QAM[180];
+
+      const static int group_tab_2_15S_16QAM[45];
+      const static int group_tab_3_15S_16QAM[45];
+      const static int group_tab_4_15S_16QAM[45];
+      const static int group_tab_5_15S_16QAM[45];
+      const static int group_tab_6_15S_16QAM[45];
+      const static int group_tab_7_15S_16QAM[45];
+      const static int group_tab_8_15S_16QAM[45];
+      const static int group_tab_9_15S_16QAM[45];
+      const static int group_tab_10_15S_16QAM[45];
+      const static int group_tab_11_15S_16QAM[45];
+      const static int group_tab_12_15S_16QAM[45];
+      const static int group_tab_13_15S_16QAM[45];
+
+      const static int group_tab_2_15N_64QAM[180];
+      const static int group_tab_3_15N_64QAM[180];
+      const static int group_tab_4_15N_64QAM[180];
+      const static int group_tab_5_15N_64QAM[180];
+      const static int group_tab_6_15N_64QAM[180];
+      const static int group_tab_7_15N_64QAM[180];
+      const static int group_tab_8_15N_64QAM[180];
+      const static int group_tab_9_15N_64QAM[180];
+      const static int group_tab_10_15N_64QAM[180];
+      const static int group_tab_11_15N_64QAM[180];
+      const static int group_tab_12_15N_64QAM[180];
+      const static int group_tab_13_15N_64QAM[180];
+
+      const static int group_tab_2_15S_64QAM[45];
+      const static int group_tab_3_15S_64QAM[45];
+      const static int group_tab_4_15S_64QAM[45];
+      const static int group_tab_5_15S_64QAM[45];
+      const static int group_tab_6_15S_64QAM[45];
+      const static int group_tab_7_15S_64QAM[45];
+      const static int group_tab_8_15S_64QAM[45];
+      const static int group_tab_9_15S_64QAM[45];
+      const static int group_tab_10_15S_64QAM[45];
+      const static int group_tab_11_15S_64QAM[45];
+      const static int group_tab_12_15S_64QAM[45];
+      const static int group_tab_13_15S_64QAM[45];
+
+      const static int group_tab_2_15N_256QAM[180];
+      const static int group_tab_3_15N_256QAM[180];
+      const static int group_tab_4_15N_256QAM[180];
+      const static int group_tab_5_15N_256QAM[180];
+      const static int group_tab_6_15N_256QAM[180];
+      const static int group_tab_7_15N_256QAM[180];
+      const static int group_tab_8_15N_256QAM[180];
+      const static int group_tab_9_15N_256QAM[180];
+      const static int group_tab_10_15N_256QAM[180];
+      const static int group_tab_11_15N_256QAM[180];
+      const static int group_tab_12_15N_256QAM[180];
+      const static int group_tab_13_15N_256QAM[180];
+
+      const static int group_tab_2_15S_256QAM[45];
+      const static int group_tab_3_15S_256QAM[45];
+      const static int group_tab_4_15S_256QAM[45];
+      const static int group_tab_5_15S_256QAM[45];
+      const static int group_tab_6_15S_256QAM[45];
+      const static int group_tab_7_15S_256QAM[45];
+      const static int group_tab_8_15S_256QAM[45];
+      const static int group_tab_9_15S_256QAM[45];
+      const static int group_tab_10_15S_256QAM[45];
+      const static int group_tab_11_15S_256QAM[45];
+      const static int group_tab_12_15S_256QAM[45];
+      const static int group_tab_13_15S_256QAM[45];
+
+      const static int group_tab_2_15N_1024QAM[180];
+      const static int group_tab_3_15N_1024QAM[180];
+      const static int group_tab_4_15N_1024QAM[180];
+      const static int group_tab_5_15N_1024QAM[180];
+      const static int group_tab_6_15N_1024QAM[180];
+      const static int group_tab_7_15N_1024QAM[180];
+      const static int group_tab_8_15N_1024QAM[180];
+      const static int group_tab_9_15N_1024QAM[180];
+      const static int group_tab_10_15N_1024QAM[180];
+      const static int group_tab_11_15N_1024QAM[180];
+      const static int group_tab_12_15N_1024QAM[180];
+      const static int group_tab_13_15N_1024QAM[180];
+
+      const static int group_tab_2_15N_4096QAM[180];
+      const static int group_tab_3_15N_4096QAM[180];
+      const static int group_tab_4_15N_4096QAM[180];
+      const static int group_tab_5_15N_4096QAM[180];
+      const static int group_tab_6_15N_4096QAM[180];
+      const static int group_tab_7_15N_4096QAM[180];
+      const static int group_tab_8_15N_4096QAM[180];
+      const static int group_tab_9_15N_4096QAM[180];
+      const static int group_tab_10_15N_4096QAM[180];
+      const static int group_tab_11_15N_4096QAM[180];
+      const static int group_tab_12_15N_4096QAM[180];
+      const static int group_tab_13_15N_4096QAM[180];
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_BIT_INTERLEAVER_H */
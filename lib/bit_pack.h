@@ -0,0 +1,48 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_BIT_PACK_H
+#define INCLUDED_ATSC3_BIT_PACK_H
+
+#include <cstdint>
+#include <cstring>
+
+namespace gr {
+  namespace atsc3 {
+
+    /* Pack 8 bits (one per byte, 0 or 1) MSB first with one multiply. */
+    static inline unsigned char
+    pack_bits8(const unsigned char* bits)
+    {
+      uint64_t x;
+      memcpy(&x, bits, sizeof(x));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      x = __builtin_bswap64(x);
+#endif
+      return (x * 0x8040201008040201ULL) >> 56;
+    }
+
+    /*
+     * Unpack a byte MSB first to 8 bits, one per byte. Each output
+     * byte keeps its own bit of the broadcast byte, adding 0x7f moves
+     * any set bit to bit 7.
+     */
+    static inline void
+    unpack_bits8(unsigned char byte, unsigned char* bits)
+    {
+      uint64_t x = (byte * 0x0101010101010101ULL) & 0x0102040810204080ULL;
+      x = ((x + 0x7f7f7f7f7f7f7f7fULL) >> 7) & 0x0101010101010101ULL;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      x = __builtin_bswap64(x);
+#endif
+      memcpy(bits, &x, sizeof(x));
+    }
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_BIT_PACK_H */
@@ -0,0 +1,150 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <map>
+#include <new>
+#include "buffer_pool.h"
+
+#define BUFFER_ALIGNMENT 64
+
+namespace gr {
+  namespace atsc3 {
+
+/*
+ * Every buffer is preceded by one alignment unit holding its index,
+ * -1 for overflow buffers, so release() needs no search.
+ */
+
+    buffer_pool::buffer_pool(size_t bytes)
+      : bytes(bytes),
+        head(0),
+        buffers(0),
+        acquired(0),
+        overflows(0),
+        in_use(0),
+        peak(0)
+    {
+      for (int i = 0; i < MAX_BUFFERS; i++) {
+        next[i].store(0, std::memory_order_relaxed);
+        buffer[i] = nullptr;
+      }
+    }
+
+    buffer_pool::~buffer_pool()
+    {
+      for (int i = 0; i < buffers; i++) {
+        ::operator delete(buffer[i] - BUFFER_ALIGNMENT, std::align_val_t(BUFFER_ALIGNMENT));
+      }
+    }
+
+    unsigned char*
+    buffer_pool::allocate(int index)
+    {
+      const size_t size = (((bytes + BUFFER_ALIGNMENT - 1) / BUFFER_ALIGNMENT) + 1) * BUFFER_ALIGNMENT;
+      unsigned char* p = static_cast<unsigned char*>(::operator new(size, std::align_val_t(BUFFER_ALIGNMENT)));
+
+      *reinterpret_cast<int*>(p) = index;
+      return p + BUFFER_ALIGNMENT;
+    }
+
+    void
+    buffer_pool::push(int index)
+    {
+      uint64_t h = head.load(std::memory_order_relaxed);
+      uint64_t n;
+
+      do {
+        next[index].store(h & 0xffffffff, std::memory_order_relaxed);
+        n = (((h >> 32) + 1) << 32) | (uint64_t)(index + 1);
+      } while (!head.compare_exchange_weak(h, n, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void
+    buffer_pool::reserve()
+    {
+      std::lock_guard<std::mutex> guard(reserve_lock);
+
+      if (buffers < MAX_BUFFERS) {
+        buffer[buffers] = allocate(buffers);
+        push(buffers);
+        buffers++;
+      }
+    }
+
+    void*
+    buffer_pool::acquire()
+    {
+      const int used = in_use.fetch_add(1, std::memory_order_relaxed) + 1;
+      int highest = peak.load(std::memory_order_relaxed);
+      uint64_t h;
+      unsigned char* p = nullptr;
+
+      while (used > highest && !peak.compare_exchange_weak(highest, used, std::memory_order_relaxed)) {
+      }
+      h = head.load(std::memory_order_acquire);
+      while (h & 0xffffffff) {
+        const int index = (h & 0xffffffff) - 1;
+        const uint64_t n = (((h >> 32) + 1) << 32) | next[index].load(std::memory_order_relaxed);
+        if (head.compare_exchange_weak(h, n, std::memory_order_acquire, std::memory_order_acquire)) {
+          p = buffer[index];
+          break;
+        }
+      }
+      if (p == nullptr) {
+        p = allocate(-1);
+        overflows.fetch_add(1, std::memory_order_relaxed);
+      }
+      acquired.fetch_add(1, std::memory_order_relaxed);
+      return p;
+    }
+
+    void
+    buffer_pool::release(void* buffer)
+    {
+      unsigned char* p = static_cast<unsigned char*>(buffer);
+      const int index = *reinterpret_cast<int*>(p - BUFFER_ALIGNMENT);
+
+      if (index < 0) {
+        ::operator delete(p - BUFFER_ALIGNMENT, std::align_val_t(BUFFER_ALIGNMENT));
+      }
+      else {
+        push(index);
+      }
+      in_use.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    buffer_pool::stats_t
+    buffer_pool::stats() const
+    {
+      stats_t s;
+
+      s.acquired = acquired.load(std::memory_order_relaxed);
+      s.overflows = overflows.load(std::memory_order_relaxed);
+      s.buffers = buffers;
+      s.in_use = in_use.load(std::memory_order_relaxed);
+      s.peak = peak.load(std::memory_order_relaxed);
+      return s;
+    }
+
+    std::shared_ptr<buffer_pool>
+    buffer_pool_shared(size_t bytes)
+    {
+      static std::mutex lock;
+      static std::map<size_t, std::weak_ptr<buffer_pool>> pools;
+
+      std::lock_guard<std::mutex> guard(lock);
+      std::weak_ptr<buffer_pool>& entry = pools[bytes];
+      std::shared_ptr<buffer_pool> pool = entry.lock();
+      if (!pool) {
+        pool = std::make_shared<buffer_pool>(bytes);
+        entry = pool;
+      }
+      return pool;
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
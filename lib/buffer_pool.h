@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_BUFFER_POOL_H
+#define INCLUDED_ATSC3_BUFFER_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Lock-free pool of fixed-size, 64-byte aligned scratch buffers.
+     *
+     * Blocks reserve() one buffer each at construction and acquire()
+     * and release() it around every work call, so blocks of the same
+     * buffer size share the memory and the work path never touches
+     * the heap. Free buffers are kept on a stack whose head carries
+     * a generation count against ABA. If more buffers are acquired
+     * than reserved, the extra ones are allocated and freed on
+     * release, and counted as overflows.
+     */
+    class buffer_pool
+    {
+     public:
+      struct stats_t {
+        uint64_t acquired;  // buffers handed out
+        uint64_t overflows; // buffers allocated because the pool was empty
+        int buffers;        // buffers owned by the pool
+        int in_use;
+        int peak;           // largest in_use so far
+      };
+
+      explicit buffer_pool(size_t bytes);
+      ~buffer_pool();
+
+      /* Add a buffer to the pool. */
+      void reserve();
+
+      void* acquire();
+      void release(void* buffer);
+
+      size_t buffer_bytes() const { return bytes; }
+      stats_t stats() const;
+
+     private:
+      static const int MAX_BUFFERS = 256;
+
+      size_t bytes;
+      std::atomic<uint64_t> head; // generation << 32 | (index + 1), 0 if empty
+      std::atomic<uint32_t> next[MAX_BUFFERS];
+      unsigned char* buffer[MAX_BUFFERS];
+      int buffers;
+      std::mutex reserve_lock;
+
+      std::atomic<uint64_t> acquired;
+      std::atomic<uint64_t> overflows;
+      std::atomic<int> in_use;
+      std::atomic<int> peak;
+
+      unsigned char* allocate(int index);
+      void push(int index);
+    };
+
+    /*
+     * Process wide pools, one per buffer size. The caller reserves
+     * its own buffers, the pool is freed with its last user.
+     */
+    std::shared_ptr<buffer_pool> buffer_pool_shared(size_t bytes);
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_BUFFER_POOL_H */
@@ -0,0 +1,44 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_CONSTELLATIONS_H
+#define INCLUDED_ATSC3_CONSTELLATIONS_H
+
+#include <atsc3/atsc3_config.h>
+#include <gnuradio/gr_complex.h>
+#include <vector>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * A/322 non-uniform constellations, shared by the modulator, the
+     * BICM block and the frame mappers.
+     *
+     * constellation_table() returns the point of every cell value of
+     * QPSK to 256QAM for a code rate index (fec_params_t::rate_index).
+     * The tables are expanded from the first quadrant at compile time
+     * and 64-byte aligned. QPSK is repeated to 16 points so SIMD
+     * permutes can load a full register, other constellations return
+     * the QPSK table.
+     */
+    const gr_complex *constellation_table(atsc3_constellation_t constellation, int rateindex);
+
+    /* Number of points (cell values) of a constellation. */
+    int constellation_size(atsc3_constellation_t constellation);
+
+    /*
+     * Points of every cell value of any constellation. 1024QAM and
+     * 4096QAM are expanded from their one-dimensional tables into
+     * expanded (8 or 32 KB), the others return constellation_table().
+     */
+    const gr_complex *constellation_points(atsc3_constellation_t constellation, int rateindex, std::vector<gr_complex> &expanded);
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_CONSTELLATIONS_H */
@@ -0,0 +1,118 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "conv_interleaver.h"
+#include "atsc3_defines.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    conv_interleaver::conv_interleaver()
+      : depth(1),
+        current(0)
+    {
+    }
+
+    void
+    conv_interleaver::init(int depth)
+    {
+      this->depth = depth;
+      current = 0;
+      memory.assign((size_t)depth * (depth - 1) / 2, gr_complex(0, 0));
+      start.resize(depth);
+      read.resize(depth);
+      for (int i = 0; i < depth; i++) {
+        start[i] = i * (i - 1) / 2;
+        read[i] = start[i];
+      }
+    }
+
+    void
+    conv_interleaver::preload(int branch, gr_complex cell)
+    {
+      int r = read[branch];
+
+      if (r == start[branch]) {
+        r += branch;
+      }
+      read[branch] = --r;
+      memory[r] = cell;
+    }
+
+    void
+    conv_interleaver::randomize(atsc3_constellation_t constellation, const gr_complex *points)
+    {
+      int sr = 0x18f;
+      int b, packed = 0, avail = 0;
+      int bits, value;
+
+      switch (constellation) {
+        case MOD_QPSK:
+          bits = 2;
+          break;
+        case MOD_16QAM:
+          bits = 4;
+          break;
+        case MOD_64QAM:
+          bits = 6;
+          break;
+        case MOD_256QAM:
+          bits = 8;
+          break;
+        default:
+          return;
+      }
+      for (int i = 1; i < depth; i++) {
+        for (int j = 0; j < i; j++) {
+          value = 0;
+          for (int n = 0; n < bits; n++) {
+            if (avail == 0) {
+              packed = ((sr & 0x4) << 5) | ((sr & 0x8) << 3) | ((sr & 0x10) << 1) | \
+                       ((sr & 0x20) >> 1) | ((sr & 0x200) >> 6) | ((sr & 0x1000) >> 10) | \
+                       ((sr & 0x2000) >> 12) | ((sr & 0x8000) >> 15);
+              b = sr & 1;
+              sr >>= 1;
+              if (b) {
+                sr ^= POLYNOMIAL;
+              }
+              avail = 8;
+            }
+            value = (value << 1) | ((packed >> --avail) & 1);
+          }
+          preload(i, points[value]);
+        }
+      }
+    }
+
+    void
+    conv_interleaver::interleave(const gr_complex *in, gr_complex *out, int cells)
+    {
+      gr_complex *mem = memory.data();
+      int branch = current;
+
+      for (int n = 0; n < cells; n++) {
+        if (branch) {
+          int r = read[branch];
+          out[n] = mem[r];
+          mem[r] = in[n];
+          if (++r == start[branch] + branch) {
+            r = start[branch];
+          }
+          read[branch] = r;
+        }
+        else {
+          out[n] = in[n];
+        }
+        if (++branch == depth) {
+          branch = 0;
+        }
+      }
+      current = branch;
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
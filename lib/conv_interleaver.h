@@ -0,0 +1,64 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_CONV_INTERLEAVER_H
+#define INCLUDED_ATSC3_CONV_INTERLEAVER_H
+
+#include <atsc3/atsc3_config.h>
+#include <gnuradio/gr_complex.h>
+#include <vector>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Convolutional time interleaver delay lines (A/322 7.1.1).
+     *
+     * Branch i delays its cells by i commutator cycles. All branches
+     * live in one triangular memory, branch i in the i cells starting
+     * at i * (i - 1) / 2, used as a circular buffer with its own read
+     * position. A cell is read and replaced by the new one in place,
+     * so interleaving is one load and one store per cell.
+     */
+    class conv_interleaver
+    {
+     public:
+      conv_interleaver();
+
+      /* depth branches, all cells zero, commutator on branch 0. */
+      void init(int depth);
+
+      /*
+       * Shift a cell into branch (> 0) from the output end, the
+       * initial contents are output in reverse order of preloading.
+       */
+      void preload(int branch, gr_complex cell);
+
+      /*
+       * Fill every branch with cells of the constellation, their values
+       * taken from the baseband scrambler PRBS (A/322 7.1.1). The PRBS
+       * is generated as the cells are loaded. Only QPSK to 256QAM are
+       * randomized, other constellations start with zero cells.
+       */
+      void randomize(atsc3_constellation_t constellation, const gr_complex *points);
+
+      void interleave(const gr_complex *in, gr_complex *out, int cells);
+
+      int commutator() const { return current; }
+
+     private:
+      int depth;
+      int current;            // commutator position
+      std::vector<gr_complex> memory;
+      std::vector<int> start; // first cell of each branch
+      std::vector<int> read;  // next cell out of each branch
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_CONV_INTERLEAVER_H */
@@ -0,0 +1,210 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <algorithm>
+#include "crc32_encoder.h"
+#include "bit_pack.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CRC32_FOLD_X86
+#elif defined(__aarch64__) && defined(__linux__)
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#define CRC32_FOLD_NEON
+#ifndef HWCAP_PMULL
+#define HWCAP_PMULL (1 << 4)
+#endif
+/* PMULL is in the crypto extension, not in the baseline ARMv8-A. */
+#if defined(__clang__)
+#define CRC32_PMULL_TARGET __attribute__((target("aes")))
+#else
+#define CRC32_PMULL_TARGET __attribute__((target("+crypto")))
+#endif
+#endif
+
+#define CRC32_POLY 0x00210801
+
+namespace gr {
+  namespace atsc3 {
+
+/*
+ * The folding kernels keep a 128-bit remainder A of the message so
+ * far, with the CRC register XORed into its top 32 bits first. Each
+ * block B is folded in as
+ *
+ *   A = A_hi * (x^192 mod P) + A_lo * (x^128 mod P) + B,
+ *
+ * which is congruent to A * x^128 + B. The register after the blocks
+ * is A * x^32 mod P, the table CRC of the 16 bytes of A from 0,
+ * which the kernels return MSB first in folded.
+ */
+
+#ifdef CRC32_FOLD_X86
+    __attribute__((target("pclmul,ssse3"))) static void
+    fold_pclmul(uint32_t crc, const unsigned char* data, int blocks, const uint64_t* k, unsigned char* folded)
+    {
+      const __m128i reverse = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+      const __m128i constants = _mm_set_epi64x(k[1], k[0]);
+      __m128i a = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), reverse);
+      a = _mm_xor_si128(a, _mm_set_epi32(crc, 0, 0, 0));
+
+      for (int i = 1; i < blocks; i++) {
+        const __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[i * 16]), reverse);
+        const __m128i hi = _mm_clmulepi64_si128(a, constants, 0x11);
+        const __m128i lo = _mm_clmulepi64_si128(a, constants, 0x00);
+        a = _mm_xor_si128(_mm_xor_si128(hi, lo), b);
+      }
+      _mm_storeu_si128((__m128i*)folded, _mm_shuffle_epi8(a, reverse));
+    }
+#endif
+
+#ifdef CRC32_FOLD_NEON
+    static inline uint64x2_t
+    load_reversed(const unsigned char* data)
+    {
+      const uint8x16_t b = vrev64q_u8(vld1q_u8(data));
+      return vreinterpretq_u64_u8(vextq_u8(b, b, 8));
+    }
+
+    CRC32_PMULL_TARGET static void
+    fold_pmull(uint32_t crc, const unsigned char* data, int blocks, const uint64_t* k, unsigned char* folded)
+    {
+      uint64x2_t a = load_reversed(data);
+      a = veorq_u64(a, vcombine_u64(vcreate_u64(0), vcreate_u64((uint64_t)crc << 32)));
+
+      for (int i = 1; i < blocks; i++) {
+        const uint64x2_t b = load_reversed(&data[i * 16]);
+        const uint64x2_t hi = vreinterpretq_u64_p128(vmull_p64((poly64_t)vgetq_lane_u64(a, 1), (poly64_t)k[1]));
+        const uint64x2_t lo = vreinterpretq_u64_p128(vmull_p64((poly64_t)vgetq_lane_u64(a, 0), (poly64_t)k[0]));
+        a = veorq_u64(veorq_u64(hi, lo), b);
+      }
+      const uint8x16_t r = vrev64q_u8(vreinterpretq_u8_u64(a));
+      vst1q_u8(folded, vextq_u8(r, r, 8));
+    }
+#endif
+
+    /* x^n mod P, bit by bit. */
+    static uint64_t
+    xpow_mod(int n)
+    {
+      uint32_t r = 1;
+      for (int i = 0; i < n; i++) {
+        r = (r << 1) ^ ((r & 0x80000000) ? CRC32_POLY : 0);
+      }
+      return r;
+    }
+
+    crc32_encoder::crc32_encoder()
+      : fold_kernel(nullptr)
+    {
+      unsigned int i, j, k;
+
+      table.resize(16 * 256);
+      for (i = 0; i < 256; i++) {
+        k = 0;
+        for (j = (i << 24) | 0x800000; j != 0x80000000; j <<= 1) {
+          k = (k << 1) ^ (((k ^ j) & 0x80000000) ? CRC32_POLY : 0);
+        }
+        table[i] = k;
+      }
+      /* table n is table n - 1 followed by one zero byte */
+      for (int n = 1; n < 16; n++) {
+        for (i = 0; i < 256; i++) {
+          const uint32_t prev = table[((n - 1) * 256) + i];
+          table[(n * 256) + i] = (prev << 8) ^ table[prev >> 24];
+        }
+      }
+      fold_constants[0] = xpow_mod(128);
+      fold_constants[1] = xpow_mod(192);
+
+      kernel_name = "slice-by-16";
+#ifdef CRC32_FOLD_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3")) {
+        fold_kernel = fold_pclmul;
+        kernel_name = "pclmul";
+      }
+#endif
+#ifdef CRC32_FOLD_NEON
+      if (getauxval(AT_HWCAP) & HWCAP_PMULL) {
+        fold_kernel = fold_pmull;
+        kernel_name = "pmull";
+      }
+#endif
+    }
+
+    uint32_t
+    crc32_encoder::update_tables(uint32_t crc, const unsigned char* data, int len) const
+    {
+      const uint32_t* t = table.data();
+
+      for (; len >= 16; len -= 16, data += 16) {
+        crc ^= ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+        crc = t[(15 * 256) + (crc >> 24)] ^ t[(14 * 256) + ((crc >> 16) & 0xff)] ^
+              t[(13 * 256) + ((crc >> 8) & 0xff)] ^ t[(12 * 256) + (crc & 0xff)] ^
+              t[(11 * 256) + data[4]] ^ t[(10 * 256) + data[5]] ^
+              t[(9 * 256) + data[6]] ^ t[(8 * 256) + data[7]] ^
+              t[(7 * 256) + data[8]] ^ t[(6 * 256) + data[9]] ^
+              t[(5 * 256) + data[10]] ^ t[(4 * 256) + data[11]] ^
+              t[(3 * 256) + data[12]] ^ t[(2 * 256) + data[13]] ^
+              t[(1 * 256) + data[14]] ^ t[data[15]];
+      }
+      for (; len > 0; len--) {
+        crc = (crc << 8) ^ t[((crc >> 24) ^ *data++) & 0xff];
+      }
+      return crc;
+    }
+
+    uint32_t
+    crc32_encoder::update(uint32_t crc, const unsigned char* data, int len) const
+    {
+      const int blocks = len / 16;
+
+      if (fold_kernel && blocks >= 2) {
+        unsigned char folded[16];
+        fold_kernel(crc, data, blocks, fold_constants, folded);
+        crc = update_tables(0, folded, 16);
+        data += blocks * 16;
+        len -= blocks * 16;
+      }
+      return update_tables(crc, data, len);
+    }
+
+    void
+    crc32_encoder::encode_bits(const unsigned char* bits, int len, unsigned char* parity) const
+    {
+      unsigned char bytes[1024];
+      uint32_t crc = 0xffffffff;
+
+      while (len >= 8) {
+        const int n = std::min(len / 8, (int)sizeof(bytes));
+        for (int i = 0; i < n; i++) {
+          bytes[i] = pack_bits8(&bits[i * 8]);
+        }
+        crc = update(crc, bytes, n);
+        bits += n * 8;
+        len -= n * 8;
+      }
+      for (int n = 0; n < 32; n++) {
+        parity[n] = (crc >> (31 - n)) & 0x1;
+      }
+    }
+
+    void
+    crc32_encoder::encode_bytes(const unsigned char* data, int len, unsigned char* parity) const
+    {
+      const uint32_t crc = update(0xffffffff, data, len);
+
+      for (int n = 0; n < 4; n++) {
+        parity[n] = crc >> (24 - (n * 8));
+      }
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
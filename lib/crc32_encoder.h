@@ -0,0 +1,64 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_CRC32_ENCODER_H
+#define INCLUDED_ATSC3_CRC32_ENCODER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * A/322 CRC-32 outer encoder, polynomial 0x00210801, MSB first,
+     * initial register 0xffffffff.
+     *
+     * The software path processes 16 bytes per step with sixteen
+     * 256-entry tables (slice-by-16). Where the CPU has a carry-less
+     * multiply (x86 PCLMULQDQ, ARMv8 PMULL) the message is folded
+     * 128 bits at a time instead and only the last block and the tail
+     * go through the tables. The path is selected at runtime.
+     */
+    class crc32_encoder
+    {
+     public:
+      crc32_encoder();
+
+      /* Continue the CRC register crc over len MSB first packed bytes. */
+      uint32_t update(uint32_t crc, const unsigned char* data, int len) const;
+
+      /*
+       * bits holds one message bit per byte (0 or 1), len is a multiple
+       * of 8. The 32 CRC bits are written to parity, one bit per byte.
+       */
+      void encode_bits(const unsigned char* bits, int len, unsigned char* parity) const;
+
+      /*
+       * data holds len MSB first packed message bytes. The 4 CRC
+       * bytes are written to parity, MSB first.
+       */
+      void encode_bytes(const unsigned char* data, int len, unsigned char* parity) const;
+
+      const std::string& name() const { return kernel_name; }
+
+     private:
+      typedef void (*fold_kernel_t)(uint32_t crc, const unsigned char* data, int blocks, const uint64_t* k, unsigned char* folded);
+
+      std::string kernel_name;
+      std::vector<uint32_t> table; // [16][256]
+      uint64_t fold_constants[2]; // x^128 mod P, x^192 mod P
+      fold_kernel_t fold_kernel;
+
+      uint32_t update_tables(uint32_t crc, const unsigned char* data, int len) const;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_CRC32_ENCODER_H */
@@ -0,0 +1,232 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <gnuradio/io_signature.h>
+#include "fec_encoder_bb_impl.h"
+#include "bit_pack.h"
+#include "params.h"
+
+#define FRAME_WAIT_MS 100
+
+namespace gr {
+  namespace atsc3 {
+
+    using input_type = unsigned char;
+    using output_type = unsigned char;
+    fec_encoder_bb::sptr
+    fec_encoder_bb::make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed)
+    {
+      return gnuradio::make_block_sptr<fec_encoder_bb_impl>(
+        framesize, rate, fecmode, packed);
+    }
+
+
+    /*
+     * The private constructor
+     */
+    fec_encoder_bb_impl::fec_encoder_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed)
+      : gr::block("fec_encoder_bb",
+              gr::io_signature::make(0, 1, sizeof(input_type)),
+              gr::io_signature::make(1, 1, sizeof(output_type))),
+        bch(framesize)
+    {
+      int num_fec_bits = 0;
+
+      switch (fecmode) {
+        case PLP_FEC_NONE:
+          num_fec_bits = 0;
+          break;
+        case PLP_FEC_CRC32:
+          num_fec_bits = 32;
+          break;
+        case PLP_FEC_BCH:
+          num_fec_bits = bch.parity_bits();
+          break;
+        default:
+          num_fec_bits = 0;
+          break;
+      }
+      if (framesize == FECFRAME_NORMAL) {
+        frame_size = FRAME_SIZE_NORMAL;
+      }
+      else {
+        frame_size = FRAME_SIZE_SHORT;
+      }
+      struct fec_params_t p = fec_params(framesize, rate);
+      nbch = p.nbch;
+      kbch = nbch - num_fec_bits;
+      plp_fec_mode = fecmode;
+      packed_mode = packed;
+      frame_bytes = frame_size / 8;
+      kbch_bytes = kbch / 8;
+      nbch_bytes = nbch / 8;
+      scrambler.init(kbch, PACKED_ON);
+      ldpc_encoder = ldpc_cache_packed(framesize, rate);
+      scratch_bytes = ((ldpc_encoder->scratch_words() * sizeof(uint64_t) + 63) / 64) * 64;
+      if (plp_fec_mode == PLP_FEC_CRC32) {
+        GR_LOG_INFO(d_logger, "CRC32 kernel: " + crc32.name());
+      }
+      set_tag_propagation_policy(TPP_DONT);
+      if (packed_mode == PACKED_ON) {
+        out_size = frame_bytes;
+      }
+      else {
+        out_size = frame_size;
+      }
+      pool = buffer_pool_shared(scratch_bytes + frame_bytes);
+      pool->reserve();
+      scratch = nullptr;
+      frame_buffer = nullptr;
+      set_output_multiple(out_size);
+      frame_mode = false;
+      message_port_register_in(pmt::mp("frames"));
+    }
+
+    /*
+     * Our virtual destructor.
+     */
+    fec_encoder_bb_impl::~fec_encoder_bb_impl()
+    {
+      const buffer_pool::stats_t stats = pool->stats();
+      if (stats.overflows) {
+        GR_LOG_WARN(d_logger, "Scratch buffer pool overflows: " + std::to_string(stats.overflows));
+      }
+    }
+
+    /*
+     * Without a connected input stream the baseband frames are taken
+     * from the "frames" port, queued PDUs as published by alpbbheader_bb.
+     * They are scrambled here like the stream input, so bbscrambler_bb
+     * does not belong in this path.
+     */
+    bool
+    fec_encoder_bb_impl::check_topology(int ninputs, int noutputs)
+    {
+      frame_mode = (ninputs == 0);
+      return true;
+    }
+
+    void
+    fec_encoder_bb_impl::forecast (int noutput_items, gr_vector_int &ninput_items_required)
+    {
+      ninput_items_required[0] = (noutput_items / out_size) * kbch_bytes;
+    }
+
+    void
+    fec_encoder_bb_impl::encode_frame(const unsigned char* in, unsigned char* frame)
+    {
+      scrambler.scramble(in, frame);
+      switch (plp_fec_mode) {
+        case PLP_FEC_CRC32:
+          crc32.encode_bytes(frame, kbch_bytes, &frame[kbch_bytes]);
+          break;
+        case PLP_FEC_BCH:
+          bch.encode_bytes(frame, kbch_bytes, &frame[kbch_bytes]);
+          break;
+        default:
+          break;
+      }
+      ldpc_encoder->encode(frame, scratch);
+    }
+
+    void
+    fec_encoder_bb_impl::encode_output(const unsigned char* in, unsigned char* out)
+    {
+      if (packed_mode == PACKED_ON) {
+        // the output buffer holds the frame, no intermediate copy
+        encode_frame(in, out);
+      }
+      else {
+        encode_frame(in, frame_buffer);
+        for (int j = 0; j < frame_bytes; j++) {
+          unpack_bits8(frame_buffer[j], &out[j * 8]);
+        }
+      }
+    }
+
+    int
+    fec_encoder_bb_impl::encode_frames(int noutput_items, unsigned char* out)
+    {
+      const pmt::pmt_t port = pmt::mp("frames");
+      const pmt::pmt_t lls = pmt::mp("lls");
+      int produced = 0;
+      size_t length;
+
+      while (produced < noutput_items) {
+        // wait for the first frame rather than spin, stop() is at most FRAME_WAIT_MS late
+        pmt::pmt_t msg = produced ? delete_head_nowait(port) : delete_head_blocking(port, FRAME_WAIT_MS);
+        if (msg.get() == NULL) {
+          break;
+        }
+        if (!pmt::is_pair(msg) || !pmt::is_u8vector(pmt::cdr(msg))) {
+          GR_LOG_WARN(d_logger, "Frame is not a u8vector PDU, dropped.");
+          continue;
+        }
+        const unsigned char* in = pmt::u8vector_elements(pmt::cdr(msg), length);
+        if ((int)length != kbch_bytes) {
+          GR_LOG_WARN(d_logger, "Frame length is not Kbch / 8 bytes, dropped.");
+          continue;
+        }
+        if (pmt::is_dict(pmt::car(msg)) && pmt::dict_has_key(pmt::car(msg), lls)) {
+          this->add_item_tag(0, this->nitems_written(0) + produced, lls, pmt::from_uint64(0));
+        }
+        encode_output(in, &out[produced]);
+        produced += out_size;
+      }
+      return produced;
+    }
+
+    int
+    fec_encoder_bb_impl::general_work (int noutput_items,
+                       gr_vector_int &ninput_items,
+                       gr_vector_const_void_star &input_items,
+                       gr_vector_void_star &output_items)
+    {
+      unsigned char* work = static_cast<unsigned char*>(pool->acquire());
+      scratch = reinterpret_cast<uint64_t*>(work);
+      frame_buffer = &work[scratch_bytes];
+
+      if (frame_mode) {
+        const int produced = encode_frames(noutput_items, static_cast<output_type*>(output_items[0]));
+        pool->release(work);
+        return produced;
+      }
+
+      auto in = static_cast<const input_type*>(input_items[0]);
+      auto out = static_cast<output_type*>(output_items[0]);
+      const int frames = noutput_items / out_size;
+
+      std::vector<tag_t> tags;
+      const uint64_t nread = this->nitems_read(0); //number of items read on port 0
+
+      // Read all tags on the input buffer
+      this->get_tags_in_range(tags, 0, nread, nread + (frames * kbch_bytes), pmt::string_to_symbol("lls"));
+      if ((int)tags.size()) {
+        const uint64_t tagoffset = this->nitems_written(0);
+        const uint64_t tagvalue = 0;
+        pmt::pmt_t key = pmt::string_to_symbol("lls");
+        pmt::pmt_t value = pmt::from_uint64(tagvalue);
+        this->add_item_tag(0, tagoffset, key, value);
+      }
+
+      for (int i = 0; i < frames; i++) {
+        encode_output(in, out);
+        in += kbch_bytes;
+        out += out_size;
+      }
+      pool->release(work);
+
+      // Tell runtime system how many input items we consumed on
+      // each input stream.
+      consume_each (frames * kbch_bytes);
+
+      // Tell runtime system how many output items we produced.
+      return noutput_items;
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_FEC_ENCODER_BB_IMPL_H
+#define INCLUDED_ATSC3_FEC_ENCODER_BB_IMPL_H
+
+#include <atsc3/fec_encoder_bb.h>
+#include <memory>
+#include "atsc3_defines.h"
+#include "bb_scrambler.h"
+#include "buffer_pool.h"
+#include "bch_encoder.h"
+#include "crc32_encoder.h"
+#include "ldpc_cache.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    class fec_encoder_bb_impl : public fec_encoder_bb
+    {
+     private:
+      int frame_size;
+      int kbch;
+      int nbch;
+      int plp_fec_mode;
+      int packed_mode;
+      int frame_bytes;
+      int kbch_bytes;
+      int nbch_bytes;
+      int out_size;
+      bool frame_mode;
+      void encode_frame(const unsigned char* in, unsigned char* frame);
+      void encode_output(const unsigned char* in, unsigned char* out);
+      int encode_frames(int noutput_items, unsigned char* out);
+
+      bb_scrambler scrambler;
+      bch_encoder bch;
+      crc32_encoder crc32;
+      std::shared_ptr<const ldpc_packed> ldpc_encoder;
+      std::shared_ptr<buffer_pool> pool;
+      size_t scratch_bytes;
+      uint64_t* scratch;          // LDPC scratch, from the pool during work
+      unsigned char* frame_buffer; // packed FECFRAME for unpacked output
+
+     public:
+      fec_encoder_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_packed_mode_t packed);
+      ~fec_encoder_bb_impl();
+
+      uint64_t pool_acquired() const { return pool->stats().acquired; }
+      uint64_t pool_overflows() const { return pool->stats().overflows; }
+      int pool_buffers() const { return pool->stats().buffers; }
+      int pool_peak() const { return pool->stats().peak; }
+
+      bool check_topology(int ninputs, int noutputs);
+      void forecast (int noutput_items, gr_vector_int &ninput_items_required);
+
+      int general_work(int noutput_items,
+           gr_vector_int &ninput_items,
+           gr_vector_const_void_star &input_items,
+           gr_vector_void_star &output_items);
+
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_FEC_ENCODER_BB_IMPL_H */
@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "frame_pool.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    frame_pool::frame_pool()
+      : bytes(0),
+        current(0)
+    {
+    }
+
+    void
+    frame_pool::init(int frame_bytes, int depth)
+    {
+      bytes = frame_bytes;
+      current = 0;
+      entries.clear();
+      entries.reserve(depth);
+      metadata[0] = pmt::make_dict();
+      metadata[1] = pmt::dict_add(pmt::make_dict(), pmt::mp("lls"), pmt::PMT_T);
+      for (int i = 0; i < depth; i++) {
+        entry e;
+
+        e.vector = pmt::make_u8vector(bytes, 0);
+        e.pdu[0] = pmt::cons(metadata[0], e.vector);
+        e.pdu[1] = pmt::cons(metadata[1], e.vector);
+        entries.push_back(e);
+      }
+    }
+
+/*
+ * Free when the pool holds the only references: the pool and its two
+ * PDUs reference the vector, nobody references the PDUs.
+ */
+
+    bool
+    frame_pool::in_flight(const entry& e) const
+    {
+      return e.vector.use_count() != 3 || e.pdu[0].use_count() != 1 || e.pdu[1].use_count() != 1;
+    }
+
+    unsigned char*
+    frame_pool::acquire()
+    {
+      size_t length;
+      const int n = entries.size();
+      int i;
+
+      for (i = 1; i <= n; i++) {
+        if (!in_flight(entries[(current + i) % n])) {
+          break;
+        }
+      }
+      if (i > n) {
+        return nullptr;
+      }
+      current = (current + i) % n;
+      return pmt::u8vector_writable_elements(entries[current].vector, length);
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
@@ -0,0 +1,66 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_FRAME_POOL_H
+#define INCLUDED_ATSC3_FRAME_POOL_H
+
+#include <pmt/pmt.h>
+#include <vector>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Preallocated baseband frames for the frame (PDU) interface of
+     * alpbbheader_bb and fec_encoder_bb.
+     *
+     * A frame is an ordinary PDU, (metadata . u8vector), with the
+     * "lls" key set in the metadata of frames that complete an LLS
+     * table. The pool keeps a reference to every PDU it has handed
+     * out and reuses one once all other references are gone, so
+     * frames are passed by pointer between blocks and recycled
+     * without allocation. The depth is fixed, with every frame in
+     * flight acquire() fails and the caller has to wait for the
+     * downstream block, which also bounds its message queue.
+     *
+     * acquire() and pdu() must be called from one thread, the PDUs may
+     * be released from any thread.
+     */
+    class frame_pool
+    {
+     public:
+      frame_pool();
+
+      /* Preallocate depth frames of frame_bytes bytes. */
+      void init(int frame_bytes, int depth);
+
+      /* Next free frame, filled in by the caller, nullptr if none is free. */
+      unsigned char* acquire();
+
+      /* PDU of the frame last acquired. */
+      pmt::pmt_t pdu(bool lls) const { return entries[current].pdu[lls ? 1 : 0]; }
+
+      int size() const { return entries.size(); }
+
+     private:
+      struct entry {
+        pmt::pmt_t vector;
+        pmt::pmt_t pdu[2]; // without and with the "lls" key
+      };
+
+      int bytes;
+      int current;
+      std::vector<entry> entries;
+      pmt::pmt_t metadata[2];
+
+      bool in_flight(const entry& e) const;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_FRAME_POOL_H */
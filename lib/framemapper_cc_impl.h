@@ -10,14 +10,17 @@
 
 #include <atsc3/framemapper_cc.h>
 #include "atsc3_defines.h"
+#include "ldpc_cache.h"
 #include "time.h"
 #include <bitset>
-#include <deque>
+#include <memory>
 #include <vector>
+#include "conv_interleaver.h"
+#include "hybrid_interleaver.h"
+#include "l1_cache.h"
 
 #define NBCH_3_15 3240
 #define NBCH_6_15 6480
-#define MAX_INTERLEAVER_DEPTH 1448
 #define NUM_SUBFRAMES 1
 #define NUM_PLPS 1
 
@@ -134,15 +137,15 @@ namespace gr {
       int preamble_syms;
       L1Signalling L1_Signalling[1];
       int add_l1basic(gr_complex*, int, int);
+      int encode_l1basic(const int*, unsigned char*);
       struct l1_detail_params_t add_l1detail(gr_complex*, int, int, int, int, int);
+      int encode_l1detail(const int*, unsigned char*);
       int add_crc32_bits(unsigned char*, int);
       void init_fm_randomizer(void);
-      void init_ti_randomizer(void);
       void calculate_crc_table();
       int poly_mult(const int*, int, const int*, int, int*);
       void bch_poly_build_tables(void);
-      void block_interleaver(unsigned char *l1, const unsigned char *l1t, gr_complex *out, int mode, int rows, int l1select);
-      void init_address(void);
+      int block_interleaver(unsigned char *l1, const unsigned char *l1t, gr_complex *out, int mode, int bits, int l1select);
       unsigned char l1_temp[FRAME_SIZE_SHORT];
       unsigned char l1_basic[FRAME_SIZE_SHORT];
       unsigned char l1_detail[FRAME_SIZE_SHORT];
@@ -151,18 +154,12 @@ namespace gr {
       int num_parity_bits;
       std::bitset<MAX_BCH_PARITY_BITS> polynome;
       int q_val;
-      int q1_val;
-      int q2_val;
-      int m1_val;
-      int m2_val;
-      int ldpc_lut_index[FRAME_SIZE_SHORT];
       unsigned char buffer[FRAME_SIZE_SHORT];
-      void ldpc_lookup_generate(void);
-      gr_complex m_qpsk[4];
-      gr_complex m_16qam[16];
-      gr_complex m_64qam[64];
-      gr_complex m_l1b_256qam[256];
-      gr_complex m_l1d_256qam[256];
+      const gr_complex *m_qpsk;
+      const gr_complex *m_16qam;
+      const gr_complex *m_64qam;
+      const gr_complex *m_l1b_256qam;
+      const gr_complex *m_l1d_256qam;
       int frame_symbols[4352];
       long long samples;
       int frame_samples;
@@ -180,40 +177,21 @@ namespace gr {
       int ti_blocks;
       int ti_fecblocks;
       int ti_fecblocks_max;
-      int Nfec_ti_max;
-      int ti_randomize[(MAX_INTERLEAVER_DEPTH * MAX_INTERLEAVER_DEPTH) * 4];
-      int commutator;
-      gr_complex ti_qpsk[4];
-      gr_complex ti_16qam[16];
-      gr_complex ti_64qam[64];
-      gr_complex ti_256qam[256];
       std::vector<gr_complex> time_interleaver;
-      std::vector<gr_complex> hybrid_time_interleaver;
-      std::vector<std::vector<std::vector<int>>> HtimeLr;
-      std::vector<std::vector<int>> HtimePr;
-      std::vector<std::vector<int>> HtimeTBI;
-      std::vector<int> HtimeNfec;
-      std::vector<std::deque<gr_complex>> delay_line;
-
-      std::vector<uint16_t*> ldpc_lut_a; // Pointers into ldpc_lut_data.
-      std::vector<uint16_t> ldpc_lut_a_data;
-      std::vector<uint16_t*> ldpc_lut_a_aux; // Pointers into ldpc_lut_data.
-      std::vector<uint16_t> ldpc_lut_a_aux_data;
-      std::vector<uint16_t*> ldpc_lut_b; // Pointers into ldpc_lut_data.
-      std::vector<uint16_t> ldpc_lut_b_data;
-
-#include "ldpc_lut.h"
+      hybrid_interleaver hybrid;
+      conv_interleaver delay_line;
+
+      std::shared_ptr<const ldpc_lut> ldpc_lut_a;
+      std::shared_ptr<const ldpc_lut> ldpc_lut_b;
+      l1_cache l1basic_cache;
+      l1_cache l1detail_cache;
+      int l1detail_xbits;
 
       const static int shortening_table[8][18];
-      const static uint16_t ldpc_tab_3_15S[12][12];
-      const static uint16_t ldpc_tab_6_15S[18][31];
       const static int group_table[8][36];
-      const static gr_complex mod_table_16QAM[12][4];
-      const static gr_complex mod_table_64QAM[12][16];
-      const static gr_complex mod_table_256QAM[12][64];
 
      public:
-      framemapper_cc_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_constellation_t constellation, atsc3_fftsize_t fftsize, int numpayloadsyms, int numpreamblesyms, atsc3_guardinterval_t guardinterval, atsc3_pilotpattern_t pilotpattern, atsc3_scattered_pilot_boost_t pilotboost, atsc3_first_sbs_t firstsbs, atsc3_frequency_interleaver_t fimode, atsc3_time_interleaver_mode_t timode, atsc3_time_interleaver_depth_t tidepth, int tiblocks, int tifecblocksmax, int tifecblocks, int plpsize, atsc3_lls_insertion_mode_t llsmode, atsc3_reduced_carriers_t cred, atsc3_frame_length_mode_t flmode, int flen, atsc3_time_info_flag_t tifmode, atsc3_miso_t misomode, atsc3_papr_t paprmode, atsc3_l1_fec_mode_t l1bmode, atsc3_l1_fec_mode_t l1dmode);
+      framemapper_cc_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_plp_fec_mode_t fecmode, atsc3_constellation_t constellation, atsc3_fftsize_t fftsize, int numpayloadsyms, int numpreamblesyms, atsc3_guardinterval_t guardinterval, atsc3_pilotpattern_t pilotpattern, atsc3_scattered_pilot_boost_t pilotboost, atsc3_first_sbs_t firstsbs, atsc3_frequency_interleaver_t fimode, atsc3_time_interleaver_mode_t timode, atsc3_time_interleaver_depth_t tidepth, int tiblocks, int tifecblocksmax, int tifecblocks, int plpsize, atsc3_lls_insertion_mode_t llsmode, atsc3_reduced_carriers_t cred, atsc3_frame_length_mode_t flmode, int flen, atsc3_time_info_flag_t tifmode, atsc3_miso_t misomode, atsc3_papr_t paprmode, atsc3_l1_fec_mode_t l1bmode, atsc3_l1_fec_mode_t l1dmode, atsc3_ti_address_mode_t tiaddress);
       ~framemapper_cc_impl();
 
       void forecast (int noutput_items, gr_vector_int &ninput_items_required);
@@ -0,0 +1,228 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "hybrid_interleaver.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    hybrid_interleaver::hybrid_interleaver()
+      : fec_cells(0),
+        ti_blocks(0),
+        Nfec_ti_max(0),
+        address_mode(TI_ADDRESS_TABLE)
+    {
+    }
+
+    void
+    hybrid_interleaver::init(int fec_cells, int ti_blocks, int ti_fecblocks, int ti_fecblocks_max, atsc3_ti_address_mode_t mode)
+    {
+      this->fec_cells = fec_cells;
+      this->ti_blocks = ti_blocks;
+      Nfec_ti_max = (ti_fecblocks_max / ti_blocks) + (ti_fecblocks_max % ti_blocks != 0);
+      address_mode = mode;
+
+      Nfec.resize(ti_blocks);
+      for (int x = 0; x < ti_blocks; x++) {
+        if (x < (ti_blocks - (ti_fecblocks % ti_blocks))) {
+          Nfec[x] = ti_fecblocks / ti_blocks;
+        }
+        else {
+          Nfec[x] = (ti_fecblocks / ti_blocks) + 1;
+        }
+      }
+      init_prbs();
+      init_shift();
+
+      address.clear();
+      if (address_mode == TI_ADDRESS_TABLE) {
+        address.resize(ti_fecblocks * fec_cells);
+        uint32_t *table = address.data();
+        generate([table](int n, uint32_t cell) { table[n] = cell; });
+      }
+    }
+
+    /* Cell interleaver PRBS, the values of the Nd - 1 bit LFSR with the toggle bit below fec_cells. */
+    void
+    hybrid_interleaver::init_prbs(void)
+    {
+      int max_states, xor_size, pn_mask, result;
+      int lfsr = 0;
+      int logic11[2] = {0, 3};
+      int logic12[2] = {0, 2};
+      int logic13[4] = {0, 1, 4, 6};
+      int logic14[6] = {0, 1, 4, 5, 9, 11};
+      int logic15[4] = {0, 1, 2, 12};
+      int* logic;
+      int pn_degree;
+      int Nd, index;
+
+      Nd = 0;
+      index = fec_cells;
+      while (index) {
+        index >>= 1;
+        Nd++;
+      }
+
+      switch (Nd) {
+        case 11:
+          pn_degree = 10;
+          pn_mask = 0x3ff;
+          max_states = 2048;
+          logic = &logic11[0];
+          xor_size = 2;
+          break;
+        case 12:
+          pn_degree = 11;
+          pn_mask = 0x7ff;
+          max_states = 4096;
+          logic = &logic12[0];
+          xor_size = 2;
+          break;
+        case 13:
+          pn_degree = 12;
+          pn_mask = 0xfff;
+          max_states = 8192;
+          logic = &logic13[0];
+          xor_size = 4;
+          break;
+        case 14:
+          pn_degree = 13;
+          pn_mask = 0x1fff;
+          max_states = 16384;
+          logic = &logic14[0];
+          xor_size = 6;
+          break;
+        case 15:
+          pn_degree = 14;
+          pn_mask = 0x3fff;
+          max_states = 32768;
+          logic = &logic15[0];
+          xor_size = 4;
+          break;
+        default:
+          pn_degree = 10;
+          pn_mask = 0x3ff;
+          max_states = 2048;
+          logic = &logic11[0];
+          xor_size = 2;
+          break;
+      }
+
+      prbs.clear();
+      prbs.reserve(fec_cells);
+      for (int j = 0; j < max_states; j++) {
+        if (j == 0 || j == 1) {
+          lfsr = 0;
+        }
+        else if (j == 2) {
+          lfsr = 1;
+        }
+        else {
+          result = 0;
+          for (int k = 0; k < xor_size; k++) {
+            result ^= (lfsr >> logic[k]) & 1;
+          }
+          lfsr &= pn_mask;
+          lfsr >>= 1;
+          lfsr |= result << (pn_degree - 1);
+        }
+        lfsr |= (j % 2) << pn_degree;
+        if (lfsr < fec_cells) {
+          prbs.push_back(lfsr);
+        }
+      }
+    }
+
+    /* Start offset of FEC block j, the bit reversal of a counter, skipping values >= fec_cells. */
+    void
+    hybrid_interleaver::init_shift(void)
+    {
+      int Nd = 0;
+      int index = fec_cells;
+      long long Pr;
+      int k = 0;
+
+      while (index) {
+        index >>= 1;
+        Nd++;
+      }
+      shift.resize(Nfec_ti_max);
+      for (int r = 0; r < Nfec_ti_max; r++) {
+        Pr = fec_cells;
+        while (Pr >= fec_cells) {
+          Pr = 0;
+          for (int j = 0; j < Nd; j++) {
+            Pr |= (k & (1 << j)) << ((Nd + 16) - 1 - j * 2);
+          }
+          Pr >>= 16;
+          k = k + 1;
+        }
+        shift[r] = Pr;
+      }
+    }
+
+/*
+ * Output cell n of TI block x is column c = n / fec_cells, row
+ * Ri = n % fec_cells of the twisted block interleaver, which reads
+ * FEC block (Ri % Nfec_ti_max + c) % Nfec_ti_max, counting the
+ * virtual blocks first, and cell Ri of that block's cell interleaver.
+ */
+
+    template <typename F>
+    void
+    hybrid_interleaver::generate(F&& f) const
+    {
+      const uint32_t *T = prbs.data();
+      const uint32_t *P = shift.data();
+      const uint32_t cells = fec_cells;
+      int out = 0;
+      uint32_t base = 0;
+
+      for (int x = 0; x < ti_blocks; x++) {
+        const int virtual_blocks = Nfec_ti_max - Nfec[x];
+        for (int c = 0; c < Nfec_ti_max; c++) {
+          int Ti = 0;
+          for (uint32_t Ri = 0; Ri < cells; Ri++) {
+            int j = Ti + c;
+            if (j >= Nfec_ti_max) {
+              j -= Nfec_ti_max;
+            }
+            j -= virtual_blocks;
+            if (j >= 0) {
+              uint32_t m = T[Ri] + P[j];
+              if (m >= cells) {
+                m -= cells;
+              }
+              f(out++, base + (j * cells) + m);
+            }
+            if (++Ti == Nfec_ti_max) {
+              Ti = 0;
+            }
+          }
+        }
+        base += cells * Nfec[x];
+      }
+    }
+
+    void
+    hybrid_interleaver::interleave(const gr_complex *in, gr_complex *out) const
+    {
+      if (address_mode == TI_ADDRESS_TABLE) {
+        const uint32_t *table = address.data();
+        const int cells = address.size();
+        for (int n = 0; n < cells; n++) {
+          out[n] = in[table[n]];
+        }
+      }
+      else {
+        generate([in, out](int n, uint32_t cell) { out[n] = in[cell]; });
+      }
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
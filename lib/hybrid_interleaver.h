@@ -0,0 +1,61 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_HYBRID_INTERLEAVER_H
+#define INCLUDED_ATSC3_HYBRID_INTERLEAVER_H
+
+#include <atsc3/atsc3_config.h>
+#include <gnuradio/gr_complex.h>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Hybrid time interleaver (A/322 7.1.2), the cell interleaver of
+     * every FEC block followed by the twisted block interleaver of
+     * every TI block, with the virtual FEC blocks skipped.
+     *
+     * The cell interleaver of FEC block j is the same PRBS sequence
+     * for every FEC block, shifted by a start offset that depends only
+     * on j, so the generator keeps fec_cells PRBS values and one
+     * offset per FEC block. The twisted block interleaver addresses
+     * are counters. With TI_ADDRESS_TABLE the composed addresses of
+     * a frame are stored once (4 bytes per PLP cell) and each frame
+     * is a single gather. With TI_ADDRESS_GENERATED they are computed
+     * again every frame.
+     */
+    class hybrid_interleaver
+    {
+     public:
+      hybrid_interleaver();
+
+      void init(int fec_cells, int ti_blocks, int ti_fecblocks, int ti_fecblocks_max, atsc3_ti_address_mode_t mode);
+
+      /* Interleave the ti_fecblocks * fec_cells cells of one frame. */
+      void interleave(const gr_complex *in, gr_complex *out) const;
+
+     private:
+      int fec_cells;
+      int ti_blocks;
+      int Nfec_ti_max;
+      atsc3_ti_address_mode_t address_mode;
+      std::vector<int> Nfec;          // FEC blocks of each TI block
+      std::vector<uint32_t> prbs;     // cell interleaver sequence
+      std::vector<uint32_t> shift;    // cell interleaver offset of each FEC block
+      std::vector<uint32_t> address;  // TI_ADDRESS_TABLE only
+
+      void init_prbs(void);
+      void init_shift(void);
+      template <typename F> void generate(F&& f) const;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_HYBRID_INTERLEAVER_H */
@@ -0,0 +1,243 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "interleaver_kernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define INTERLEAVER_KERNELS_X86
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define INTERLEAVER_KERNELS_NEON
+#endif
+
+namespace gr {
+  namespace atsc3 {
+
+    struct unpacked_bits
+    {
+      static inline unsigned int
+      get(const unsigned char* frame, unsigned int bit)
+      {
+        return frame[bit];
+      }
+    };
+
+    struct packed_bits
+    {
+      static inline unsigned int
+      get(const unsigned char* frame, unsigned int bit)
+      {
+        return (frame[bit >> 3] >> (7 - (bit & 0x7))) & 0x1;
+      }
+    };
+
+    template <int MOD, class BITS>
+    static inline void
+    cells_tail(const uint16_t* perm, int stride, int first, int cells, const unsigned char* frame, unsigned short* out)
+    {
+      for (int j = first; j < cells; j++) {
+        unsigned int pack = 0;
+        for (int e = 0; e < MOD; e++) {
+          pack = (pack << 1) | BITS::get(frame, perm[(e * stride) + j]);
+        }
+        out[j] = pack;
+      }
+    }
+
+    template <int MOD, class BITS>
+    static void
+    cells_generic(const uint16_t* perm, int stride, int cells, const unsigned char* frame, unsigned short* out)
+    {
+      cells_tail<MOD, BITS>(perm, stride, 0, cells, frame, out);
+    }
+
+    /* Gather bit plane e of cells j to j + 15. */
+    template <int MOD, class BITS>
+    static inline void
+    gather_planes(const uint16_t* perm, int stride, int j, const unsigned char* frame, unsigned char planes[][16])
+    {
+      for (int e = 0; e < MOD; e++) {
+        const uint16_t* p = &perm[(e * stride) + j];
+        for (int w = 0; w < 16; w++) {
+          planes[e][w] = BITS::get(frame, p[w]);
+        }
+      }
+    }
+
+#ifdef INTERLEAVER_KERNELS_X86
+    template <int MOD, class BITS>
+    __attribute__((target("sse2"))) static void
+    cells_sse2(const uint16_t* perm, int stride, int cells, const unsigned char* frame, unsigned short* out)
+    {
+      const __m128i zero = _mm_setzero_si128();
+      unsigned char planes[MOD][16];
+      int j = 0;
+
+      for (; j + 16 <= cells; j += 16) {
+        gather_planes<MOD, BITS>(perm, stride, j, frame, planes);
+        __m128i lo = zero, hi = zero;
+        for (int e = 0; e < MOD; e++) {
+          const __m128i x = _mm_loadu_si128((const __m128i*)planes[e]);
+          lo = _mm_or_si128(_mm_slli_epi16(lo, 1), _mm_unpacklo_epi8(x, zero));
+          hi = _mm_or_si128(_mm_slli_epi16(hi, 1), _mm_unpackhi_epi8(x, zero));
+        }
+        _mm_storeu_si128((__m128i*)&out[j], lo);
+        _mm_storeu_si128((__m128i*)&out[j + 8], hi);
+      }
+      cells_tail<MOD, BITS>(perm, stride, j, cells, frame, out);
+    }
+
+/*
+ * The gathers load 32 bits at frame + byte, the wanted bit is shifted
+ * down to bit 0 (a variable shift for packed frames) and masked. The
+ * masked forms with a zero source keep GCC from warning about the
+ * undefined pass-through register of the plain gathers (and of the
+ * AVX-512 conversions and shifts).
+ */
+
+    template <bool PACKED>
+    __attribute__((target("avx2"))) static inline __m256i
+    gather_avx2(const unsigned char* frame, const uint16_t* p)
+    {
+      const __m256i index = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)p));
+      if (PACKED) {
+        const __m256i shift = _mm256_sub_epi32(_mm256_set1_epi32(7), _mm256_and_si256(index, _mm256_set1_epi32(7)));
+        const __m256i bytes = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int*)frame, _mm256_srli_epi32(index, 3), _mm256_set1_epi32(-1), 1);
+        return _mm256_and_si256(_mm256_srlv_epi32(bytes, shift), _mm256_set1_epi32(1));
+      }
+      return _mm256_and_si256(_mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int*)frame, index, _mm256_set1_epi32(-1), 1), _mm256_set1_epi32(1));
+    }
+
+    template <int MOD, class BITS, bool PACKED>
+    __attribute__((target("avx2"))) static void
+    cells_avx2(const uint16_t* perm, int stride, int cells, const unsigned char* frame, unsigned short* out)
+    {
+      int j = 0;
+
+      for (; j + 16 <= cells; j += 16) {
+        __m256i a0 = _mm256_setzero_si256(), a1 = _mm256_setzero_si256();
+        for (int e = 0; e < MOD; e++) {
+          const uint16_t* p = &perm[(e * stride) + j];
+          a0 = _mm256_or_si256(_mm256_slli_epi32(a0, 1), gather_avx2<PACKED>(frame, p));
+          a1 = _mm256_or_si256(_mm256_slli_epi32(a1, 1), gather_avx2<PACKED>(frame, p + 8));
+        }
+        const __m256i c = _mm256_permute4x64_epi64(_mm256_packus_epi32(a0, a1), 0xd8);
+        _mm256_storeu_si256((__m256i*)&out[j], c);
+      }
+      cells_tail<MOD, BITS>(perm, stride, j, cells, frame, out);
+    }
+
+    template <bool PACKED>
+    __attribute__((target("avx512f"))) static inline __m512i
+    gather_avx512(const unsigned char* frame, const uint16_t* p)
+    {
+      const __m512i index = _mm512_maskz_cvtepu16_epi32(0xffff, _mm256_loadu_si256((const __m256i*)p));
+      if (PACKED) {
+        const __m512i shift = _mm512_sub_epi32(_mm512_set1_epi32(7), _mm512_and_si512(index, _mm512_set1_epi32(7)));
+        const __m512i bytes = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xffff, _mm512_maskz_srli_epi32(0xffff, index, 3), frame, 1);
+        return _mm512_and_si512(_mm512_maskz_srlv_epi32(0xffff, bytes, shift), _mm512_set1_epi32(1));
+      }
+      return _mm512_and_si512(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xffff, index, frame, 1), _mm512_set1_epi32(1));
+    }
+
+    template <int MOD, class BITS, bool PACKED>
+    __attribute__((target("avx512f"))) static void
+    cells_avx512(const uint16_t* perm, int stride, int cells, const unsigned char* frame, unsigned short* out)
+    {
+      int j = 0;
+
+      for (; j + 32 <= cells; j += 32) {
+        __m512i a0 = _mm512_setzero_si512(), a1 = _mm512_setzero_si512();
+        for (int e = 0; e < MOD; e++) {
+          const uint16_t* p = &perm[(e * stride) + j];
+          a0 = _mm512_or_si512(_mm512_maskz_slli_epi32(0xffff, a0, 1), gather_avx512<PACKED>(frame, p));
+          a1 = _mm512_or_si512(_mm512_maskz_slli_epi32(0xffff, a1, 1), gather_avx512<PACKED>(frame, p + 16));
+        }
+        _mm256_storeu_si256((__m256i*)&out[j], _mm512_maskz_cvtepi32_epi16(0xffff, a0));
+        _mm256_storeu_si256((__m256i*)&out[j + 16], _mm512_maskz_cvtepi32_epi16(0xffff, a1));
+      }
+      cells_tail<MOD, BITS>(perm, stride, j, cells, frame, out);
+    }
+#endif
+
+#ifdef INTERLEAVER_KERNELS_NEON
+/*
+ * vsli shifts the accumulated cell left by one and inserts the
+ * plane bit below it.
+ */
+
+    template <int MOD, class BITS>
+    static void
+    cells_neon(const uint16_t* perm, int stride, int cells, const unsigned char* frame, unsigned short* out)
+    {
+      unsigned char planes[MOD][16];
+      int j = 0;
+
+      for (; j + 16 <= cells; j += 16) {
+        gather_planes<MOD, BITS>(perm, stride, j, frame, planes);
+        uint16x8_t lo = vdupq_n_u16(0), hi = vdupq_n_u16(0);
+        for (int e = 0; e < MOD; e++) {
+          const uint8x16_t x = vld1q_u8(planes[e]);
+          lo = vsliq_n_u16(vmovl_u8(vget_low_u8(x)), lo, 1);
+          hi = vsliq_n_u16(vmovl_u8(vget_high_u8(x)), hi, 1);
+        }
+        vst1q_u16(&out[j], lo);
+        vst1q_u16(&out[j + 8], hi);
+      }
+      cells_tail<MOD, BITS>(perm, stride, j, cells, frame, out);
+    }
+#endif
+
+#define CELL_KERNEL(kernel, mod, ...) \
+      ((mod) == 2 ? kernel<2, __VA_ARGS__> : (mod) == 4 ? kernel<4, __VA_ARGS__> : \
+       (mod) == 6 ? kernel<6, __VA_ARGS__> : (mod) == 8 ? kernel<8, __VA_ARGS__> : \
+       (mod) == 10 ? kernel<10, __VA_ARGS__> : (mod) == 12 ? kernel<12, __VA_ARGS__> : \
+       kernel<1, __VA_ARGS__>)
+
+    interleaver_kernels::interleaver_kernels()
+      : kernel_name("generic"),
+        unpacked_kernel(cells_generic<1, unpacked_bits>),
+        packed_kernel(cells_generic<1, packed_bits>)
+    {
+    }
+
+    void
+    interleaver_kernels::init(int mod)
+    {
+      kernel_name = "generic";
+      unpacked_kernel = CELL_KERNEL(cells_generic, mod, unpacked_bits);
+      packed_kernel = CELL_KERNEL(cells_generic, mod, packed_bits);
+#ifdef INTERLEAVER_KERNELS_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f")) {
+        unpacked_kernel = CELL_KERNEL(cells_avx512, mod, unpacked_bits, false);
+        packed_kernel = CELL_KERNEL(cells_avx512, mod, packed_bits, true);
+        kernel_name = "avx512";
+      }
+      else if (__builtin_cpu_supports("avx2")) {
+        unpacked_kernel = CELL_KERNEL(cells_avx2, mod, unpacked_bits, false);
+        packed_kernel = CELL_KERNEL(cells_avx2, mod, packed_bits, true);
+        kernel_name = "avx2";
+      }
+      else if (__builtin_cpu_supports("sse2")) {
+        unpacked_kernel = CELL_KERNEL(cells_sse2, mod, unpacked_bits);
+        packed_kernel = CELL_KERNEL(cells_sse2, mod, packed_bits);
+        kernel_name = "sse2";
+      }
+#endif
+#ifdef INTERLEAVER_KERNELS_NEON
+      unpacked_kernel = CELL_KERNEL(cells_neon, mod, unpacked_bits);
+      packed_kernel = CELL_KERNEL(cells_neon, mod, packed_bits);
+      kernel_name = "neon";
+#endif
+    }
+
+#undef CELL_KERNEL
+
+  } /* namespace atsc3 */
+} /* namespace gr */
@@ -0,0 +1,64 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_INTERLEAVER_KERNELS_H
+#define INCLUDED_ATSC3_INTERLEAVER_KERNELS_H
+
+#include <cstdint>
+#include <string>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Runtime dispatched cell formation kernels for the bit interleaver.
+     *
+     * The permutation is plane-major: entry (e * stride) + j is the
+     * codeword bit that becomes bit e (MSB first) of cell j, so bit
+     * plane e of 16 or 32 consecutive cells is one contiguous load of
+     * indices. The kernels gather a plane and shift it into the cells,
+     * specialized per modulation order so the plane loop is unrolled.
+     * AVX2 and AVX-512 gather the planes with vpgatherdd, SSE2 and NEON
+     * gather them into a small bit-plane block and pack that with
+     * widening 16-bit shift and insert.
+     *
+     * The frame may be over-read by 3 bytes past its end.
+     */
+    class interleaver_kernels
+    {
+     public:
+      interleaver_kernels();
+
+      /* Select the kernels for mod bits per cell. */
+      void init(int mod);
+
+      /* frame holds one bit per byte. */
+      void interleave(const uint16_t* perm, int stride, int cells, const unsigned char* frame, unsigned short* out) const
+      {
+        unpacked_kernel(perm, stride, cells, frame, out);
+      }
+
+      /* frame holds MSB first packed bytes. */
+      void interleave_packed(const uint16_t* perm, int stride, int cells, const unsigned char* frame, unsigned short* out) const
+      {
+        packed_kernel(perm, stride, cells, frame, out);
+      }
+
+      const std::string& name() const { return kernel_name; }
+
+     private:
+      typedef void (*cell_kernel_t)(const uint16_t* perm, int stride, int cells, const unsigned char* frame, unsigned short* out);
+
+      std::string kernel_name;
+      cell_kernel_t unpacked_kernel;
+      cell_kernel_t packed_kernel;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_INTERLEAVER_KERNELS_H */
@@ -0,0 +1,136 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstring>
+#include <stdexcept>
+#include "l1_cache.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    /* L1B_time_offset, L1B_lls_flag */
+    const int l1basic_field_bits[L1B_FIELDS] = {16, 1};
+
+    /* L1D_plp_fec_block_start, L1D_plp_CTI_start_row (two PLPs), L1D_time_sec/msec/usec/nsec */
+    const int l1detail_field_bits[L1D_FIELDS] = {22, 11, 22, 11, 32, 10, 10, 10};
+
+    l1_cache::l1_cache()
+      : num_fields(0),
+        coded_bits(0),
+        words(0),
+        built(false)
+    {
+    }
+
+    void
+    l1_cache::init(int num_fields, const int *field_bits, int max_bits, encoder_t encoder)
+    {
+      this->num_fields = num_fields;
+      this->field_bits.assign(field_bits, field_bits + num_fields);
+      this->encoder = encoder;
+      built = false;
+      scratch.resize(max_bits);
+      codeword.clear();
+      columns.clear();
+      column.clear();
+    }
+
+    void
+    l1_cache::pack(std::vector<uint64_t>& out, int index)
+    {
+      uint64_t *p = &out[index];
+
+      for (int w = 0; w < words; w++) {
+        p[w] = 0;
+      }
+      for (int i = 0; i < coded_bits; i++) {
+        p[i >> 6] |= (uint64_t)scratch[i] << (i & 63);
+      }
+    }
+
+/*
+ * The column of a field bit is the difference of the codewords with
+ * the bit flipped and not, the constant part of the affine map drops
+ * out. Bits outside the field's encoding give an all zero column and
+ * are not stored.
+ */
+
+    void
+    l1_cache::build(const int *fields)
+    {
+      std::vector<int> probe(fields, fields + num_fields);
+      int index;
+      bool toggled;
+
+      values.assign(fields, fields + num_fields);
+      coded_bits = encoder(fields, scratch.data());
+      words = (coded_bits + 63) / 64;
+      codeword.resize(words);
+      pack(codeword, 0);
+
+      columns.clear();
+      column.assign(num_fields * 32, -1);
+      for (int f = 0; f < num_fields; f++) {
+        for (int bit = 0; bit < field_bits[f]; bit++) {
+          probe[f] = (int)(values[f] ^ (1u << bit));
+          if (encoder(probe.data(), scratch.data()) != coded_bits) {
+            throw std::runtime_error("L1 signalling layout depends on a dynamic field.");
+          }
+          probe[f] = fields[f];
+          index = columns.size();
+          columns.resize(index + words);
+          pack(columns, index);
+          toggled = false;
+          for (int w = 0; w < words; w++) {
+            columns[index + w] ^= codeword[w];
+            toggled |= (columns[index + w] != 0);
+          }
+          if (toggled) {
+            column[f * 32 + bit] = index;
+          }
+          else {
+            columns.resize(index);
+          }
+        }
+      }
+      built = true;
+    }
+
+    int
+    l1_cache::encode(const int *fields, unsigned char *coded)
+    {
+      uint32_t diff;
+      int bit, index;
+
+      if (!built) {
+        const int bits = encoder(fields, scratch.data());
+        memcpy(coded, scratch.data(), bits);
+        return bits;
+      }
+      for (int f = 0; f < num_fields; f++) {
+        diff = values[f] ^ (uint32_t)fields[f];
+        values[f] = fields[f];
+        while (diff) {
+          bit = __builtin_ctz(diff);
+          diff &= diff - 1;
+          index = column[f * 32 + bit];
+          if (index >= 0) {
+            const uint64_t *c = &columns[index];
+            for (int w = 0; w < words; w++) {
+              codeword[w] ^= c[w];
+            }
+          }
+        }
+      }
+      for (int i = 0; i < coded_bits; i++) {
+        coded[i] = (codeword[i >> 6] >> (i & 63)) & 1;
+      }
+      return coded_bits;
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
@@ -0,0 +1,89 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_L1_CACHE_H
+#define INCLUDED_ATSC3_L1_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace gr {
+  namespace atsc3 {
+
+    /* L1-Basic fields that change from frame to frame. */
+    enum {
+      L1B_TIME_OFFSET = 0,
+      L1B_LLS_FLAG,
+      L1B_FIELDS,
+    };
+
+    /* L1-Detail fields that change from frame to frame. */
+    enum {
+      L1D_BLOCK_START0 = 0,
+      L1D_START_ROW0,
+      L1D_BLOCK_START1,
+      L1D_START_ROW1,
+      L1D_TIME_SEC,
+      L1D_TIME_MSEC,
+      L1D_TIME_USEC,
+      L1D_TIME_NSEC,
+      L1D_FIELDS,
+    };
+
+    /* Widest encoding of each field in bits. */
+    extern const int l1basic_field_bits[L1B_FIELDS];
+    extern const int l1detail_field_bits[L1D_FIELDS];
+
+    /*
+     * Incremental L1 encoder.
+     *
+     * With the signalling layout fixed, the L1 FEC chain (CRC32,
+     * scrambling, BCH, shortened LDPC, repetition, puncturing and
+     * zero removal) is affine over GF(2) in the signalling bits.
+     * build() keeps the coded bits of one encode packed, and for
+     * every bit of a dynamic field the coded bits it toggles, so
+     * encode() only XORs in the columns of the field bits that
+     * changed since the last frame.
+     */
+    class l1_cache
+    {
+     public:
+      /* Full encode, coded bits one per byte, returns the number of coded bits. */
+      typedef std::function<int(const int *fields, unsigned char *coded)> encoder_t;
+
+      l1_cache();
+
+      /* Until build(), every encode() is a full encode. */
+      void init(int num_fields, const int *field_bits, int max_bits, encoder_t encoder);
+
+      /* The static signalling must be final, fields are the starting values. */
+      void build(const int *fields);
+
+      /* Coded bits of fields, one per byte, returns the number of coded bits. */
+      int encode(const int *fields, unsigned char *coded);
+
+     private:
+      int num_fields;
+      int coded_bits;
+      int words;
+      bool built;
+      encoder_t encoder;
+      std::vector<int> field_bits;
+      std::vector<uint32_t> values;   // fields of codeword
+      std::vector<uint64_t> codeword;
+      std::vector<uint64_t> columns;  // coded bits toggled by each field bit
+      std::vector<int> column;        // field * 32 + bit, -1 if the bit is not encoded
+      std::vector<unsigned char> scratch;
+
+      void pack(std::vector<uint64_t>& out, int index);
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_L1_CACHE_H */
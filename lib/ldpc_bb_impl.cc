@@ -15,21 +15,32 @@ namespace gr {
     using input_type = unsigned char;
     using output_type = unsigned char;
     ldpc_bb::sptr
-    ldpc_bb::make(atsc3_framesize_t framesize, atsc3_code_rate_t rate)
+    ldpc_bb::make(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_packed_mode_t packed, int threads)
     {
       return gnuradio::make_block_sptr<ldpc_bb_impl>(
-        framesize, rate);
+        framesize, rate, packed, threads);
     }
 
 
     /*
      * The private constructor
      */
-    ldpc_bb_impl::ldpc_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate)
+    ldpc_bb_impl::ldpc_bb_impl(atsc3_framesize_t framesize, atsc3_code_rate_t rate, atsc3_packed_mode_t packed, int threads)
       : gr::block("ldpc_bb",
               gr::io_signature::make(1, 1, sizeof(input_type)),
-              gr::io_signature::make(1, 1, sizeof(output_type)))
+              gr::io_signature::make(1, 1, sizeof(output_type))),
+        pool_generation(0),
+        pool_running(0),
+        pool_exit(false),
+        job_in(nullptr),
+        job_out(nullptr),
+        job_frames(0),
+        job_next(0)
     {
+      if (threads < 1) {
+        throw std::runtime_error("LDPC encoder threads must be at least 1.");
+      }
+      num_threads = threads;
       frame_size_type = framesize;
       if (framesize == FECFRAME_NORMAL) {
         frame_size = FRAME_SIZE_NORMAL;
@@ -39,16 +50,26 @@ namespace gr {
       }
       struct fec_params_t p = fec_params(framesize, rate);
       nbch = p.nbch;
-      q_val = p.q_val;
-      q1_val = p.q1_val;
-      q2_val = p.q2_val;
-      m1_val = p.m1_val;
-      m2_val = p.m2_val;
-      ldpc_type = p.ldpc_type;
       code_rate = rate;
-      ldpc_lookup_generate();
+      packed_mode = packed;
+      frame_bytes = frame_size / 8;
+      nbch_bytes = nbch / 8;
+      if (packed_mode == PACKED_ON) {
+        ldpc_encoder = ldpc_cache_packed(framesize, rate);
+      }
+      else {
+        lut = ldpc_cache_lut(framesize, rate);
+      }
+      GR_LOG_INFO(d_logger, "LDPC kernel: " + kernel_name());
       set_tag_propagation_policy(TPP_DONT);
-      set_output_multiple(frame_size);
+      if (packed_mode == PACKED_ON) {
+        scratch.resize(num_threads * ldpc_encoder->scratch_words());
+        set_output_multiple(frame_bytes);
+      }
+      else {
+        buffer.resize(num_threads * (frame_size - nbch));
+        set_output_multiple(frame_size);
+      }
     }
 
     /*
@@ -56,100 +77,108 @@ namespace gr {
      */
     ldpc_bb_impl::~ldpc_bb_impl()
     {
+      stop();
     }
 
-    void
-    ldpc_bb_impl::forecast (int noutput_items, gr_vector_int &ninput_items_required)
+    bool
+    ldpc_bb_impl::start()
     {
-      ninput_items_required[0] = (noutput_items / frame_size) * nbch;
+      unsigned int generation;
+
+      /* pool_generation survives stop() and start(), only later passes are the workers'. */
+      {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        pool_exit = false;
+        generation = pool_generation;
+      }
+      for (int i = 1; i < num_threads; i++) {
+        workers.emplace_back(&ldpc_bb_impl::worker_loop, this, i, generation);
+      }
+      return block::start();
     }
 
-/*
- * fill the lookup table, for each paritybit it contains
- * {number of infobits, infobit1, infobit2, ... ]
- * maximum number of infobits is calculated using the entries
- * in the ldpc tables
- */
+    bool
+    ldpc_bb_impl::stop()
+    {
+      {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        pool_exit = true;
+      }
+      pool_start.notify_all();
+      for (auto& worker : workers) {
+        worker.join();
+      }
+      workers.clear();
+      return block::stop();
+    }
 
     void
-    ldpc_bb_impl::ldpc_lookup_generate(void)
+    ldpc_bb_impl::worker_loop(int worker, unsigned int generation)
     {
-      if (frame_size_type == FECFRAME_NORMAL) {
-        if (code_rate == C2_15) {
-          ldpc_bf_type_a(ldpc_tab_2_15N);
-        }
-        if (code_rate == C3_15) {
-          ldpc_bf_type_a(ldpc_tab_3_15N);
-        }
-        if (code_rate == C4_15) {
-          ldpc_bf_type_a(ldpc_tab_4_15N);
-        }
-        if (code_rate == C5_15) {
-          ldpc_bf_type_a(ldpc_tab_5_15N);
-        }
-        if (code_rate == C6_15) {
-          ldpc_bf_type_b(ldpc_tab_6_15N);
-        }
-        if (code_rate == C7_15) {
-          ldpc_bf_type_a(ldpc_tab_7_15N);
-        }
-        if (code_rate == C8_15) {
-          ldpc_bf_type_b(ldpc_tab_8_15N);
-        }
-        if (code_rate == C9_15) {
-          ldpc_bf_type_b(ldpc_tab_9_15N);
-        }
-        if (code_rate == C10_15) {
-          ldpc_bf_type_b(ldpc_tab_10_15N);
-        }
-        if (code_rate == C11_15) {
-          ldpc_bf_type_b(ldpc_tab_11_15N);
-        }
-        if (code_rate == C12_15) {
-          ldpc_bf_type_b(ldpc_tab_12_15N);
+      while (true) {
+        {
+          std::unique_lock<std::mutex> lock(pool_mutex);
+          pool_start.wait(lock, [&] { return pool_exit || pool_generation != generation; });
+          if (pool_exit) {
+            return;
+          }
+          generation = pool_generation;
         }
-        if (code_rate == C13_15) {
-          ldpc_bf_type_b(ldpc_tab_13_15N);
+        run_frames(worker);
+        {
+          std::lock_guard<std::mutex> lock(pool_mutex);
+          pool_running--;
         }
+        pool_done.notify_one();
       }
-      else if (frame_size_type == FECFRAME_SHORT) {
-        if (code_rate == C2_15) {
-          ldpc_bf_type_a(ldpc_tab_2_15S);
-        }
-        if (code_rate == C3_15) {
-          ldpc_bf_type_a(ldpc_tab_3_15S);
-        }
-        if (code_rate == C4_15) {
-          ldpc_bf_type_a(ldpc_tab_4_15S);
-        }
-        if (code_rate == C5_15) {
-          ldpc_bf_type_a(ldpc_tab_5_15S);
-        }
-        if (code_rate == C6_15) {
-          ldpc_bf_type_b(ldpc_tab_6_15S);
-        }
-        if (code_rate == C7_15) {
-          ldpc_bf_type_b(ldpc_tab_7_15S);
-        }
-        if (code_rate == C8_15) {
-          ldpc_bf_type_b(ldpc_tab_8_15S);
-        }
-        if (code_rate == C9_15) {
-          ldpc_bf_type_b(ldpc_tab_9_15S);
-        }
-        if (code_rate == C10_15) {
-          ldpc_bf_type_b(ldpc_tab_10_15S);
-        }
-        if (code_rate == C11_15) {
-          ldpc_bf_type_b(ldpc_tab_11_15S);
-        }
-        if (code_rate == C12_15) {
-          ldpc_bf_type_b(ldpc_tab_12_15S);
-        }
-        if (code_rate == C13_15) {
-          ldpc_bf_type_b(ldpc_tab_13_15S);
-        }
+    }
+
+    void
+    ldpc_bb_impl::run_frames(int worker)
+    {
+      const int in_size = (packed_mode == PACKED_ON) ? nbch_bytes : nbch;
+      const int out_size = (packed_mode == PACKED_ON) ? frame_bytes : frame_size;
+      int frame;
+
+      while ((frame = job_next.fetch_add(1)) < job_frames) {
+        encode_frame(&job_in[frame * in_size], &job_out[frame * out_size], worker);
+      }
+    }
+
+    std::string
+    ldpc_bb_impl::kernel_name() const
+    {
+      if (packed_mode == PACKED_ON) {
+        return "packed";
       }
+      return lut->kernel_name();
+    }
+
+    void
+    ldpc_bb_impl::forecast (int noutput_items, gr_vector_int &ninput_items_required)
+    {
+      if (packed_mode == PACKED_ON) {
+        ninput_items_required[0] = (noutput_items / frame_bytes) * nbch_bytes;
+      }
+      else {
+        ninput_items_required[0] = (noutput_items / frame_size) * nbch;
+      }
+    }
+
+    void
+    ldpc_bb_impl::encode_frame(const unsigned char* in, unsigned char* out, int worker)
+    {
+      // Calculate the number of parity bits
+      const int plen = frame_size - nbch;
+
+      if (packed_mode == PACKED_ON) {
+        memcpy(out, in, sizeof(unsigned char) * nbch_bytes);
+        ldpc_encoder->encode(out, &scratch[worker * ldpc_encoder->scratch_words()]);
+        return;
+      }
+      // copy the information bits, the kernels over-read them, so encode the output copy
+      memcpy(out, in, sizeof(unsigned char) * nbch);
+      lut->encode(out, &buffer[worker * plen]);
     }
 
     int
@@ -160,21 +189,15 @@ namespace gr {
     {
       auto in = static_cast<const input_type*>(input_items[0]);
       auto out = static_cast<output_type*>(output_items[0]);
-      const unsigned char* d;
-      unsigned char* p;
-      // Calculate the number of parity bits
-      int plen = frame_size - nbch;
-      p = &out[nbch];
-      int consumed = 0;
-      const int q1 = q1_val;
-      const int q2 = q2_val;
-      const int m1 = m1_val;
+      const int in_size = (packed_mode == PACKED_ON) ? nbch_bytes : nbch;
+      const int out_size = (packed_mode == PACKED_ON) ? frame_bytes : frame_size;
+      const int frames = noutput_items / out_size;
 
       std::vector<tag_t> tags;
       const uint64_t nread = this->nitems_read(0); //number of items read on port 0
 
       // Read all tags on the input buffer
-      this->get_tags_in_range(tags, 0, nread, nread + ((noutput_items / frame_size) * nbch), pmt::string_to_symbol("lls"));
+      this->get_tags_in_range(tags, 0, nread, nread + (frames * in_size), pmt::string_to_symbol("lls"));
       if ((int)tags.size()) {
         const uint64_t tagoffset = this->nitems_written(0);
         const uint64_t tagvalue = 0;
@@ -183,1531 +206,34 @@ namespace gr {
         this->add_item_tag(0, tagoffset, key, value);
       }
 
-      for (int i = 0; i < noutput_items; i += frame_size) {
-        // copy the information bits
-        memcpy(out, &in[consumed], sizeof(unsigned char) * nbch);
-        consumed += nbch;
-        if (ldpc_type == LDPC_TYPE_A) {
-          // now do the parity checking
-          d = out;
-          for (int i_p = 0; i_p < plen; i_p++) {
-            unsigned char pbit = 0;
-            for (int i_d = 1; i_d < ldpc_lut[i_p][0]; i_d++) {
-              pbit ^= d[ldpc_lut[i_p][i_d]];
-            }
-            buffer[i_p] = pbit;
-          }
-          for (int j = 1; j < m1; j++) {
-            buffer[j] ^= buffer[j-1];
-          }
-          for (int t = 0; t < q1; t++) {
-            for (int s = 0; s < 360; s++) {
-              out[nbch + (360 * t) + s] = buffer[(q1 * s) + t];
-            }
-          }
-          for (int i_p = 0; i_p < plen; i_p++) {
-            unsigned char pbit = 0;
-            unsigned int count = 0;
-            for (int i_d = 1; i_d < ldpc_lut_aux[i_p][0]; i_d++) {
-              pbit ^= d[ldpc_lut_aux[i_p][i_d]];
-              count++;
-            }
-            if (count) {
-              buffer[i_p] ^= pbit;
-            }
-          }
-          for (int t = 0; t < q2; t++) {
-            for (int s = 0; s < 360; s++) {
-              out[nbch + m1 + (360 * t) + s] = buffer[(m1 + q2 * s) + t];
-            }
-          }
-        }
-        else {
-          // now do the parity checking
-          d = &in[consumed - nbch];
-          for (int i_p = 0; i_p < plen; i_p++) {
-            unsigned char pbit = 0;
-            for (int i_d = 1; i_d < ldpc_lut[i_p][0]; i_d++) {
-              pbit ^= d[ldpc_lut[i_p][i_d]];
-            }
-            p[i_p] = pbit;
-          }
-          for (int j = 1; j < plen; j++) {
-            p[j] ^= p[j - 1];
-          }
+      if (workers.empty() || frames == 1) {
+        for (int i = 0; i < frames; i++) {
+          encode_frame(&in[i * in_size], &out[i * out_size], 0);
         }
-        out += frame_size;
-        p += frame_size;
+      }
+      else {
+        {
+          std::lock_guard<std::mutex> lock(pool_mutex);
+          job_in = in;
+          job_out = out;
+          job_frames = frames;
+          job_next = 0;
+          pool_running = workers.size();
+          pool_generation++;
+        }
+        pool_start.notify_all();
+        run_frames(0);
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        pool_done.wait(lock, [&] { return pool_running == 0; });
       }
 
       // Tell runtime system how many input items we consumed on
       // each input stream.
-      consume_each (consumed);
+      consume_each (frames * in_size);
 
       // Tell runtime system how many output items we produced.
       return noutput_items;
     }
 
-    const uint16_t ldpc_bb_impl::ldpc_tab_2_15N[29][21] = {
-      {19, 615, 898, 1029, 6129, 8908, 10620, 13378, 14359, 21964, 23319, 26427, 26690, 28128, 33435, 36080, 40697, 43525, 44498, 50994, 0},
-      {19, 165, 1081, 1637, 2913, 8944, 9639, 11391, 17341, 22000, 23580, 32309, 38495, 41239, 44079, 47395, 47460, 48282, 51744, 52782, 0},
-      {19, 426, 1340, 1493, 2261, 10903, 13336, 14755, 15244, 20543, 29822, 35283, 38846, 45368, 46642, 46934, 48242, 49000, 49204, 53370, 0},
-      {19, 407, 1059, 1366, 2004, 5985, 9217, 9321, 13576, 19659, 20808, 30009, 31094, 32445, 39094, 39357, 40651, 44358, 48755, 49732, 0},
-      {19, 692, 950, 1444, 2967, 3929, 6951, 10157, 10326, 11547, 13562, 19634, 34484, 38236, 42918, 44685, 46172, 49694, 50535, 55109, 0},
-      {19, 1087, 1458, 1574, 2335, 3248, 6965, 17856, 23454, 25182, 37359, 37718, 37768, 38061, 38728, 39437, 40710, 46298, 50707, 51572, 0},
-      {19, 1098, 1540, 1711, 7723, 9549, 9986, 16369, 19567, 21185, 21319, 25750, 32222, 32463, 40342, 41391, 43869, 48372, 52149, 54722, 0},
-      {19, 514, 1283, 1635, 6602, 11333, 11443, 17690, 21036, 22936, 24525, 25425, 27103, 28733, 29551, 39204, 42525, 49200, 54899, 54961, 0},
-      {19, 357, 609, 1096, 2954, 4240, 5397, 8425, 13974, 15252, 20167, 20362, 21623, 27190, 42744, 47819, 49096, 51995, 55504, 55719, 0},
-      {19, 25, 448, 1501, 11572, 13478, 24338, 29198, 29840, 31428, 33088, 34724, 37698, 37988, 38297, 40482, 46953, 47880, 53751, 54943, 0},
-      {19, 328, 1096, 1262, 10802, 12797, 16053, 18038, 20433, 20444, 25422, 32992, 34344, 38326, 41435, 46802, 48766, 49807, 52966, 55751, 0},
-      {19, 34, 790, 987, 5082, 5788, 10778, 12824, 18217, 23278, 24737, 28312, 34464, 36765, 37999, 39603, 40797, 43237, 53089, 55319, 0},
-      {19, 226, 1149, 1470, 3483, 8949, 9312, 9773, 13271, 17804, 20025, 20323, 30623, 38575, 39887, 40305, 46986, 47223, 49998, 52111, 0},
-      {19, 1088, 1091, 1757, 2682, 5526, 5716, 9665, 10733, 12997, 14440, 24665, 27990, 30203, 33173, 37423, 38934, 40494, 45418, 48393, 0},
-      {19, 809, 1278, 1580, 3486, 4529, 6117, 6212, 6823, 7861, 9244, 11559, 20736, 30333, 32450, 35528, 42968, 44485, 47149, 54913, 0},
-      {19, 369, 525, 1622, 2261, 6454, 10483, 11259, 16461, 17031, 20221, 22710, 25137, 26622, 27904, 30884, 31858, 44121, 50690, 56000, 0},
-      {19, 423, 1291, 1352, 7883, 26107, 26157, 26876, 27071, 31515, 35340, 35953, 36608, 37795, 37842, 38527, 41720, 46206, 47998, 53019, 0},
-      {19, 540, 662, 1433, 2828, 14410, 22880, 24263, 24802, 28242, 28396, 35928, 37214, 39748, 43915, 44905, 46590, 48684, 48890, 55926, 0},
-      {19, 214, 1291, 1622, 7311, 8985, 20952, 22752, 23261, 24896, 25057, 28826, 37074, 37707, 38742, 46026, 51116, 51521, 52956, 54213, 0},
-      {20, 109, 1305, 1676, 2594, 7447, 8943, 14806, 16462, 19730, 23430, 24542, 34300, 36432, 37133, 41199, 43942, 45860, 47598, 48401, 49407},
-      {20, 242, 388, 1360, 6721, 14220, 21029, 22536, 25126, 32251, 33182, 39192, 42436, 44144, 45252, 46238, 47369, 47607, 47695, 50635, 51469},
-      {20, 199, 958, 1111, 13661, 18809, 19234, 21459, 25221, 25837, 28256, 36919, 39031, 39107, 39262, 43572, 45018, 45959, 48006, 52387, 55811},
-      {20, 668, 1087, 1451, 2945, 3319, 12519, 21248, 21344, 22627, 22701, 28152, 29670, 31430, 32655, 38533, 42233, 43200, 44013, 44459, 51398},
-      {20, 244, 1133, 1665, 8222, 8740, 11285, 12774, 15922, 20147, 20978, 28927, 35086, 40197, 40583, 41066, 41223, 42104, 44650, 45391, 48437},
-      {17, 5623, 8050, 9679, 12978, 15846, 16049, 21807, 23364, 27226, 27758, 28661, 38147, 46337, 48141, 51364, 51927, 55124, 0, 0, 0},
-      {17, 10369, 13704, 14491, 18632, 19430, 21218, 33392, 36182, 36722, 37342, 37415, 46322, 47449, 51136, 53392, 54356, 55108, 0, 0, 0},
-      {17, 7460, 9411, 11132, 11739, 13722, 15501, 25588, 26463, 26738, 31980, 31981, 35002, 39659, 39783, 41581, 51358, 55114, 0, 0, 0},
-      {17, 8915, 15253, 15264, 16513, 16896, 18367, 19110, 23492, 32074, 33302, 42443, 43797, 44715, 47538, 48515, 53464, 53548, 0, 0, 0},
-      {17, 5884, 8910, 10123, 11311, 13654, 14207, 16122, 18113, 23100, 23784, 24825, 39629, 46372, 52454, 52799, 55039, 55973, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_3_15N[41][16] = {
-      {15, 920, 963, 1307, 2648, 6529, 17455, 18883, 19848, 19909, 24149, 24249, 38395, 41589, 48032, 50313},
-      {15, 297, 736, 744, 5951, 8438, 9881, 15522, 16462, 23036, 25071, 34915, 41193, 42975, 43412, 49612},
-      {15, 10, 223, 879, 4662, 6400, 8691, 14561, 16626, 17408, 22810, 31795, 32580, 43639, 45223, 47511},
-      {15, 629, 842, 1666, 3150, 7596, 9465, 12327, 18649, 19052, 19279, 29743, 30197, 40106, 48371, 51155},
-      {15, 857, 953, 1116, 8725, 8726, 10508, 17112, 21007, 30649, 32113, 36962, 39254, 46636, 49599, 50099},
-      {15, 700, 894, 1128, 5527, 6216, 15123, 21510, 24584, 29026, 31416, 37158, 38460, 42511, 46932, 51832},
-      {15, 430, 592, 1521, 3018, 10430, 18090, 18092, 18388, 20017, 34383, 35006, 38255, 41700, 42158, 45211},
-      {15, 91, 1485, 1733, 11624, 12969, 17531, 21324, 23657, 27148, 27509, 28753, 35093, 43352, 48104, 51648},
-      {15, 18, 34, 117, 6739, 8679, 11018, 12163, 16733, 24113, 25906, 30605, 32700, 36465, 40799, 43359},
-      {15, 481, 1545, 1644, 4216, 4606, 6015, 6609, 14659, 16966, 18056, 19137, 26670, 28001, 30668, 49061},
-      {15, 174, 1208, 1387, 10580, 11507, 13751, 16344, 22735, 23559, 26492, 27672, 33399, 44787, 44842, 45992},
-      {15, 1151, 1185, 1472, 6727, 10701, 14755, 15688, 17441, 21281, 23692, 23994, 31366, 35854, 37301, 43148},
-      {15, 200, 799, 1583, 3451, 5880, 7604, 8194, 13428, 16109, 18584, 20463, 22373, 31977, 47073, 50087},
-      {15, 346, 843, 1352, 13409, 17376, 18233, 19119, 19382, 20578, 24183, 32052, 32912, 43204, 48539, 49893},
-      {15, 76, 457, 1169, 13516, 14520, 14638, 22391, 25294, 31067, 31325, 36711, 44072, 44854, 49274, 51624},
-      {15, 759, 798, 1420, 6661, 12101, 12573, 13796, 15510, 18384, 26649, 30875, 36856, 38994, 43634, 49281},
-      {15, 551, 797, 1000, 3999, 10040, 11246, 15793, 23298, 23822, 38480, 39209, 45334, 46603, 46625, 47633},
-      {15, 441, 875, 1554, 5336, 25948, 28842, 30329, 31503, 39203, 39673, 46250, 47021, 48555, 49229, 51421},
-      {15, 963, 1470, 1642, 3180, 3943, 6513, 9125, 15641, 17083, 18876, 28499, 32764, 42420, 43922, 45762},
-      {15, 293, 324, 867, 8803, 10582, 17926, 19830, 22497, 24848, 30034, 34659, 37721, 41523, 42534, 47806},
-      {15, 687, 975, 1356, 2721, 3002, 3874, 4119, 12336, 17119, 21251, 22482, 22833, 24681, 26225, 48514},
-      {15, 549, 951, 1268, 9144, 11710, 12623, 18949, 19362, 22769, 32603, 34559, 34683, 36338, 47140, 51069},
-      {15, 52, 890, 1669, 3905, 5670, 14712, 18314, 22297, 30328, 33389, 35447, 35512, 35516, 40587, 41918},
-      {15, 656, 1063, 1694, 3338, 3793, 4513, 6009, 7441, 13393, 20920, 26501, 27576, 29623, 31261, 42093},
-      {15, 425, 1018, 1086, 9226, 10024, 17552, 24714, 24877, 25853, 28918, 30945, 31205, 33103, 42564, 47214},
-      {15, 32, 1145, 1438, 4916, 4945, 14830, 17505, 19919, 24118, 28506, 30173, 31754, 34230, 48608, 50291},
-      {15, 559, 1216, 1272, 2856, 8703, 9371, 9708, 16180, 19127, 24337, 26390, 36649, 41105, 42988, 44096},
-      {15, 362, 658, 1191, 7769, 8998, 14068, 15921, 18471, 18780, 31995, 32798, 32864, 37293, 39468, 44308},
-      {15, 1136, 1389, 1785, 8800, 12541, 14723, 15210, 15859, 26569, 30127, 31357, 32898, 38760, 50523, 51715},
-      {15, 44, 80, 1368, 2010, 2228, 6614, 6767, 9275, 25237, 30208, 39537, 42041, 49906, 50701, 51199},
-      {15, 1522, 1536, 1765, 3914, 5350, 10869, 12278, 12886, 16379, 22743, 23987, 26306, 30966, 33854, 41356},
-      {15, 212, 648, 709, 3443, 7007, 7545, 12484, 13358, 17008, 20433, 25862, 31945, 39207, 39752, 40313},
-      {15, 789, 1062, 1431, 12280, 17415, 18098, 23729, 37278, 38454, 38763, 41039, 44600, 50700, 51139, 51696},
-      {15, 825, 1298, 1391, 4882, 12738, 17569, 19177, 19896, 27401, 37041, 39181, 39199, 41832, 43636, 45775},
-      {15, 992, 1053, 1485, 3806, 16929, 18596, 22017, 23435, 23932, 30211, 30390, 34469, 37213, 46220, 49646},
-      {15, 771, 850, 1039, 5180, 7653, 13547, 17980, 23365, 25318, 34374, 36115, 38753, 42993, 49696, 51031},
-      {12, 7383, 14780, 15959, 18921, 22579, 28612, 32038, 36727, 40851, 41947, 42707, 50480, 0, 0, 0},
-      {12, 8733, 9464, 13148, 13899, 19396, 22933, 23039, 25047, 29938, 33588, 33796, 48930, 0, 0, 0},
-      {12, 2493, 12555, 16706, 23905, 35400, 36330, 37065, 38866, 40305, 43807, 43917, 50621, 0, 0, 0},
-      {12, 6437, 11927, 14542, 16617, 17317, 17755, 18832, 24772, 29273, 31136, 36925, 46663, 0, 0, 0},
-      {12, 2191, 3431, 6288, 6430, 9908, 13069, 23014, 24822, 29818, 39914, 46010, 47246, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_4_15N[53][14] = {
-      {13, 276, 1754, 1780, 3597, 8549, 15196, 26305, 27003, 33883, 37189, 41042, 41849, 42356},
-      {13, 730, 873, 927, 9310, 9867, 17594, 21969, 25106, 25922, 31167, 35434, 37742, 45866},
-      {13, 925, 1202, 1564, 2575, 2831, 2951, 5193, 13096, 18363, 20592, 33786, 34090, 40900},
-      {13, 973, 1045, 1071, 8545, 8980, 11983, 18649, 21323, 22789, 22843, 26821, 36720, 37856},
-      {13, 402, 1038, 1689, 2466, 2893, 13474, 15710, 24137, 29709, 30451, 35568, 35966, 46436},
-      {13, 263, 271, 395, 5089, 5645, 15488, 16314, 28778, 29729, 34350, 34533, 39608, 45371},
-      {13, 387, 1059, 1306, 1955, 6990, 20001, 24606, 28167, 33802, 35181, 38481, 38688, 45140},
-      {13, 53, 851, 1750, 3493, 11415, 18882, 20244, 23411, 28715, 30722, 36487, 38019, 45416},
-      {13, 810, 1044, 1772, 3906, 5832, 16793, 17333, 17910, 23946, 29650, 34190, 40673, 45828},
-      {13, 97, 491, 948, 12156, 13788, 24970, 33774, 37539, 39750, 39820, 41195, 46464, 46820},
-      {13, 192, 899, 1283, 3732, 7310, 13637, 13810, 19005, 24227, 26772, 31273, 37665, 44005},
-      {13, 424, 531, 1300, 4860, 8983, 10137, 16323, 16888, 17933, 22458, 26917, 27835, 37931},
-      {13, 130, 279, 731, 3024, 6378, 18838, 19746, 21007, 22825, 23109, 28644, 32048, 34667},
-      {12, 938, 1041, 1482, 9589, 10065, 11535, 17477, 25816, 27966, 35022, 35025, 42536, 0},
-      {12, 170, 454, 1312, 5326, 6765, 23408, 24090, 26072, 33037, 38088, 42985, 46413, 0},
-      {12, 220, 804, 843, 2921, 4841, 7760, 8303, 11259, 21058, 21276, 34346, 37604, 0},
-      {12, 676, 713, 832, 11937, 12006, 12309, 16329, 26438, 34214, 37471, 38179, 42420, 0},
-      {12, 714, 931, 1580, 6837, 9824, 11257, 15556, 26730, 32053, 34461, 35889, 45821, 0},
-      {12, 28, 1097, 1340, 8767, 9406, 17253, 29558, 32857, 37856, 38593, 41781, 47101, 0},
-      {12, 158, 722, 754, 14489, 23851, 28160, 30371, 30579, 34963, 44216, 46462, 47463, 0},
-      {12, 833, 1326, 1332, 7032, 9566, 11011, 21424, 26827, 29789, 31699, 32876, 37498, 0},
-      {12, 251, 504, 1075, 4470, 7736, 11242, 20397, 32719, 34453, 36571, 40344, 46341, 0},
-      {12, 330, 581, 868, 15168, 20265, 26354, 33624, 35134, 38609, 44965, 45209, 46909, 0},
-      {12, 729, 1643, 1732, 3946, 4912, 9615, 19699, 30993, 33658, 38712, 39424, 46799, 0},
-      {12, 546, 982, 1274, 9264, 11017, 11868, 15674, 16277, 19204, 28606, 39063, 43331, 0},
-      {12, 73, 1160, 1196, 4334, 12560, 13583, 14703, 18270, 18719, 19327, 38985, 46779, 0},
-      {12, 1147, 1625, 1759, 3767, 5912, 11599, 18561, 19330, 29619, 33671, 43346, 44098, 0},
-      {12, 104, 1507, 1586, 9387, 17890, 23532, 27008, 27861, 30966, 33579, 35541, 39801, 0},
-      {12, 1700, 1746, 1793, 4941, 7814, 13746, 20375, 27441, 30262, 30392, 35385, 42848, 0},
-      {12, 183, 555, 1029, 3090, 5412, 8148, 19662, 23312, 23933, 28179, 29962, 35514, 0},
-      {12, 891, 908, 1127, 2827, 4077, 4376, 4570, 26923, 27456, 33699, 43431, 46071, 0},
-      {12, 404, 1110, 1782, 6003, 14452, 19247, 26998, 30137, 31404, 31624, 46621, 47366, 0},
-      {12, 886, 1627, 1704, 8193, 8980, 9648, 10928, 16267, 19774, 35111, 38545, 44735, 0},
-      {12, 268, 380, 1214, 4797, 5168, 9109, 9288, 17992, 21309, 33210, 36210, 41429, 0},
-      {12, 572, 1121, 1165, 6944, 7114, 20978, 23540, 25863, 26190, 26365, 41521, 44690, 0},
-      {12, 18, 185, 496, 5885, 6165, 20468, 23895, 24745, 31226, 33680, 37665, 38587, 0},
-      {12, 289, 527, 1118, 11275, 12015, 18088, 22805, 24679, 28262, 30160, 34892, 43212, 0},
-      {12, 658, 926, 1589, 7634, 16231, 22193, 25320, 26057, 26512, 27498, 29472, 34219, 0},
-      {12, 337, 801, 1525, 2023, 3512, 16031, 26911, 32719, 35620, 39035, 43779, 44316, 0},
-      {12, 248, 534, 670, 6217, 11430, 24090, 26509, 28712, 33073, 33912, 38048, 39813, 0},
-      {12, 82, 1556, 1575, 7879, 7892, 14714, 22404, 22773, 25531, 34170, 38203, 38254, 0},
-      {12, 247, 313, 1224, 3694, 14304, 24033, 26394, 28101, 37455, 37859, 38997, 41344, 0},
-      {12, 790, 887, 1418, 2811, 3288, 9049, 9704, 13303, 14262, 38149, 40109, 40477, 0},
-      {12, 1310, 1384, 1471, 3716, 8250, 25371, 26329, 26997, 30138, 40842, 41041, 44921, 0},
-      {12, 86, 288, 367, 1860, 8713, 18211, 22628, 22811, 28342, 28463, 40415, 45845, 0},
-      {12, 719, 1438, 1741, 8258, 10797, 29270, 29404, 32096, 34433, 34616, 36030, 45597, 0},
-      {12, 215, 1182, 1364, 8146, 9949, 10498, 18603, 19304, 19803, 23685, 43304, 45121, 0},
-      {12, 1243, 1496, 1537, 8484, 8851, 16589, 17665, 20152, 24283, 28993, 34274, 39795, 0},
-      {10, 6320, 6785, 15841, 16309, 20512, 25804, 27421, 28941, 43871, 44647, 0, 0, 0},
-      {10, 2207, 2713, 4450, 12217, 16506, 21188, 23933, 28789, 38099, 42392, 0, 0, 0},
-      {10, 14064, 14307, 14599, 14866, 17540, 18881, 21065, 25823, 30341, 36963, 0, 0, 0},
-      {10, 14259, 14396, 17037, 26769, 29219, 29319, 31689, 33013, 35631, 37319, 0, 0, 0},
-      {10, 7798, 10495, 12868, 14298, 17221, 23344, 31908, 39809, 41001, 41965, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_5_15N[64][12] = {
-      {11, 221, 1011, 1218, 4299, 7143, 8728, 11072, 15533, 17356, 33909, 36833},
-      {11, 360, 1210, 1375, 2313, 3493, 16822, 21373, 23588, 23656, 26267, 34098},
-      {11, 544, 1347, 1433, 2457, 9186, 10945, 13583, 14858, 19195, 34606, 37441},
-      {11, 37, 596, 715, 4134, 8091, 12106, 24307, 24658, 34108, 40591, 42883},
-      {11, 235, 398, 1204, 2075, 6742, 11670, 13512, 23231, 24784, 27915, 34752},
-      {11, 204, 873, 890, 13550, 16570, 19774, 34012, 35249, 37655, 39885, 42890},
-      {11, 221, 371, 514, 11984, 14972, 15690, 28827, 29069, 30531, 31018, 43121},
-      {11, 280, 549, 1435, 1889, 3310, 10234, 11575, 15243, 20748, 30469, 36005},
-      {11, 223, 666, 1248, 13304, 14433, 14732, 18943, 21248, 23127, 38529, 39272},
-      {11, 370, 819, 1065, 9461, 10319, 25294, 31958, 33542, 37458, 39681, 40039},
-      {11, 585, 870, 1028, 5087, 5216, 12228, 16216, 16381, 16937, 27132, 27893},
-      {11, 164, 167, 1210, 7386, 11151, 20413, 22713, 23134, 24188, 36771, 38992},
-      {11, 298, 511, 809, 4620, 7347, 8873, 19602, 24162, 29198, 34304, 41145},
-      {11, 105, 830, 1212, 2415, 14759, 15440, 16361, 16748, 22123, 32684, 42575},
-      {11, 659, 665, 668, 6458, 22130, 25972, 30697, 31074, 32048, 36078, 37129},
-      {11, 91, 808, 953, 8015, 8988, 13492, 13987, 15979, 28355, 34509, 39698},
-      {11, 594, 983, 1265, 3028, 4029, 9366, 11069, 11512, 27066, 40939, 41639},
-      {11, 506, 740, 1321, 1484, 10747, 16376, 17384, 20285, 31502, 38925, 42606},
-      {11, 338, 356, 975, 2022, 3578, 18689, 18772, 19826, 22914, 24733, 27431},
-      {11, 709, 1264, 1366, 4617, 8893, 25226, 27800, 29080, 30277, 37781, 39644},
-      {11, 840, 1179, 1338, 2973, 3541, 7043, 12712, 15005, 17149, 19910, 36795},
-      {11, 1009, 1267, 1380, 4919, 12679, 22889, 29638, 30987, 34637, 36232, 37284},
-      {11, 466, 913, 1247, 1646, 3049, 5924, 9014, 20539, 34546, 35029, 36540},
-      {11, 374, 697, 984, 1654, 5870, 10883, 11684, 20294, 28888, 31612, 34031},
-      {11, 117, 240, 635, 5093, 8673, 11323, 12456, 14145, 21397, 39619, 42559},
-      {11, 122, 1265, 1427, 13528, 14282, 15241, 16852, 17227, 34723, 36836, 39791},
-      {11, 595, 1180, 1310, 6952, 17916, 24725, 24971, 27243, 29555, 32138, 35987},
-      {11, 140, 470, 1017, 13222, 13253, 18462, 20806, 21117, 28673, 31598, 37235},
-      {11, 7, 710, 1072, 8014, 10804, 13303, 14292, 16690, 26676, 36443, 41966},
-      {11, 48, 189, 759, 12438, 14523, 16388, 23178, 27315, 28656, 29111, 29694},
-      {11, 285, 387, 410, 4294, 4467, 5949, 25386, 27898, 34880, 41169, 42614},
-      {11, 474, 545, 1320, 10506, 13186, 18126, 27110, 31498, 35353, 36193, 37322},
-      {11, 1075, 1130, 1424, 11390, 13312, 14161, 16927, 25071, 25844, 34287, 38151},
-      {11, 161, 396, 427, 5944, 17281, 22201, 25218, 30143, 35566, 38261, 42513},
-      {11, 233, 247, 694, 1446, 3180, 3507, 9069, 20764, 21940, 33422, 39358},
-      {11, 271, 508, 1013, 6271, 21760, 21858, 24887, 29808, 31099, 35475, 39924},
-      {11, 8, 674, 1329, 3135, 5110, 14460, 28108, 28388, 31043, 31137, 31863},
-      {11, 1035, 1222, 1409, 8287, 16083, 24450, 24888, 29356, 30329, 37834, 39684},
-      {11, 391, 1090, 1128, 1866, 4095, 10643, 13121, 14499, 20056, 22195, 30593},
-      {11, 55, 161, 1402, 6289, 6837, 8791, 17937, 21425, 26602, 30461, 37241},
-      {11, 110, 377, 1228, 6875, 13253, 17032, 19008, 23274, 32285, 33452, 41630},
-      {11, 360, 638, 1355, 5933, 12593, 13533, 23377, 23881, 24586, 26040, 41663},
-      {11, 535, 1240, 1333, 3354, 10860, 16032, 32573, 34908, 34957, 39255, 40759},
-      {11, 526, 936, 1321, 7992, 10260, 18527, 28248, 29356, 32636, 34666, 35552},
-      {11, 336, 785, 875, 7530, 13062, 13075, 18925, 27963, 28703, 33688, 36502},
-      {11, 36, 591, 1062, 1518, 3821, 7048, 11197, 17781, 19408, 22731, 24783},
-      {11, 214, 1145, 1223, 1546, 9475, 11170, 16061, 21273, 38688, 40051, 42479},
-      {11, 1136, 1226, 1423, 20227, 22573, 24951, 26462, 29586, 34915, 42441, 43048},
-      {11, 26, 276, 1425, 6048, 7224, 7917, 8747, 27559, 28515, 35002, 37649},
-      {11, 127, 294, 437, 4029, 8585, 9647, 11904, 24115, 28514, 36893, 39722},
-      {11, 748, 1093, 1403, 9536, 19305, 20468, 31049, 38667, 40502, 40720, 41949},
-      {11, 96, 638, 743, 9806, 12101, 17751, 22732, 24937, 32007, 32594, 38504},
-      {11, 649, 904, 1079, 2770, 3337, 9158, 20125, 24619, 32921, 33698, 35173},
-      {11, 401, 518, 984, 7372, 12438, 12582, 18704, 35874, 39420, 39503, 39790},
-      {11, 10, 451, 1077, 8078, 16320, 17409, 25807, 28814, 30613, 41261, 42955},
-      {11, 405, 592, 1178, 15936, 18418, 19585, 21966, 24219, 30637, 34536, 37838},
-      {11, 50, 584, 851, 9720, 11919, 22544, 22545, 25851, 35567, 41587, 41876},
-      {11, 911, 1113, 1176, 1806, 10058, 10809, 14220, 19044, 20748, 29424, 36671},
-      {11, 441, 550, 1135, 1956, 11254, 18699, 30249, 33099, 34587, 35243, 39952},
-      {11, 510, 1016, 1281, 8621, 13467, 13780, 15170, 16289, 20925, 26426, 34479},
-      {8, 4969, 5223, 17117, 21950, 22144, 24043, 27151, 39809, 0, 0, 0},
-      {8, 11452, 13622, 18918, 19670, 23995, 32647, 37200, 37399, 0, 0, 0},
-      {8, 6351, 6426, 13185, 13973, 16699, 22524, 31070, 31916, 0, 0, 0},
-      {8, 4098, 10617, 14854, 18004, 28580, 36158, 37500, 38552, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_6_15N[72][28] = {
-      {27, 1606, 3402, 4961, 6751, 7132, 11516, 12300, 12482, 12592, 13342, 13764, 14123, 21576, 23946, 24533, 25376, 25667, 26836, 31799, 34173, 35462, 36153, 36740, 37085, 37152, 37468, 37658},
-      {27, 4621, 5007, 6910, 8732, 9757, 11508, 13099, 15513, 16335, 18052, 19512, 21319, 23663, 25628, 27208, 31333, 32219, 33003, 33239, 33447, 36200, 36473, 36938, 37201, 37283, 37495, 38642},
-      {27, 16, 1094, 2020, 3080, 4194, 5098, 5631, 6877, 7889, 8237, 9804, 10067, 11017, 11366, 13136, 13354, 15379, 18934, 20199, 24522, 26172, 28666, 30386, 32714, 36390, 37015, 37162},
-      {27, 700, 897, 1708, 6017, 6490, 7372, 7825, 9546, 10398, 16605, 18561, 18745, 21625, 22137, 23693, 24340, 24966, 25015, 26995, 28586, 28895, 29687, 33938, 34520, 34858, 37056, 38297},
-      {27, 159, 2010, 2573, 3617, 4452, 4958, 5556, 5832, 6481, 8227, 9924, 10836, 14954, 15594, 16623, 18065, 19249, 22394, 22677, 23408, 23731, 24076, 24776, 27007, 28222, 30343, 38371},
-      {27, 3118, 3545, 4768, 4992, 5227, 6732, 8170, 9397, 10522, 11508, 15536, 20218, 21921, 28599, 29445, 29758, 29968, 31014, 32027, 33685, 34378, 35867, 36323, 36728, 36870, 38335, 38623},
-      {27, 1264, 4254, 6936, 9165, 9486, 9950, 10861, 11653, 13697, 13961, 15164, 15665, 18444, 19470, 20313, 21189, 24371, 26431, 26999, 28086, 28251, 29261, 31981, 34015, 35850, 36129, 37186},
-      {27, 111, 1307, 1628, 2041, 2524, 5358, 7988, 8191, 10322, 11905, 12919, 14127, 15515, 15711, 17061, 19024, 21195, 22902, 23727, 24401, 24608, 25111, 25228, 27338, 35398, 37794, 38196},
-      {27, 961, 3035, 7174, 7948, 13355, 13607, 14971, 18189, 18339, 18665, 18875, 19142, 20615, 21136, 21309, 21758, 23366, 24745, 25849, 25982, 27583, 30006, 31118, 32106, 36469, 36583, 37920},
-      {27, 2990, 3549, 4273, 4808, 5707, 6021, 6509, 7456, 8240, 10044, 12262, 12660, 13085, 14750, 15680, 16049, 21587, 23997, 25803, 28343, 28693, 34393, 34860, 35490, 36021, 37737, 38296},
-      {27, 955, 4323, 5145, 6885, 8123, 9730, 11840, 12216, 19194, 20313, 23056, 24248, 24830, 25268, 26617, 26801, 28557, 29753, 30745, 31450, 31973, 32839, 33025, 33296, 35710, 37366, 37509},
-      {27, 264, 605, 4181, 4483, 5156, 7238, 8863, 10939, 11251, 12964, 16254, 17511, 20017, 22395, 22818, 23261, 23422, 24064, 26329, 27723, 28186, 30434, 31956, 33971, 34372, 36764, 38123},
-      {27, 520, 2562, 2794, 3528, 3860, 4402, 5676, 6963, 8655, 9018, 9783, 11933, 16336, 17193, 17320, 19035, 20606, 23579, 23769, 24123, 24966, 27866, 32457, 34011, 34499, 36620, 37526},
-      {4, 10106, 10637, 10906, 34242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1856, 15100, 19378, 21848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 943, 11191, 27806, 29411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4575, 6359, 13629, 19383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4476, 4953, 18782, 24313, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 5441, 6381, 21840, 35943, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 9638, 9763, 12546, 30120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 9587, 10626, 11047, 25700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4088, 15298, 28768, 35047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2332, 6363, 8782, 28863, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4625, 4933, 28298, 30289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 3541, 4918, 18257, 31746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1221, 25233, 26757, 34892, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 8150, 16677, 27934, 30021, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 8500, 25016, 33043, 38070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 7374, 10207, 16189, 35811, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 611, 18480, 20064, 38261, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 25416, 27352, 36089, 38469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1667, 17614, 25839, 32776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4118, 12481, 21912, 37945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 5573, 13222, 23619, 31271, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 18271, 26251, 27182, 30587, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 14690, 26430, 26799, 34355, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 13688, 16040, 20716, 34558, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2740, 14957, 23436, 32540, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 3491, 14365, 14681, 36858, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4796, 6238, 25203, 27854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1731, 12816, 17344, 26025, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 19182, 21662, 23742, 27872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6502, 13641, 17509, 34713, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 12246, 12372, 16746, 27452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1589, 21528, 30621, 34003, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 12328, 20515, 30651, 31432, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 3415, 22656, 23427, 36395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 632, 5209, 25958, 31085, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 619, 3690, 19648, 37778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 9528, 13581, 26965, 36447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2147, 26249, 26968, 28776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 15698, 18209, 30683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1132, 19888, 34111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4608, 25513, 38874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 475, 1729, 34100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7348, 32277, 38587, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 182, 16473, 33082, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3865, 9678, 21265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4447, 20151, 27618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6335, 14371, 38711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 704, 9695, 28858, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4856, 9757, 30546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1993, 19361, 30732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 756, 28000, 29138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3821, 24076, 31813, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4611, 12326, 32291, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7628, 21515, 34995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1246, 13294, 30068, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6466, 33233, 35865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14484, 23274, 38150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 21269, 36411, 37450, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 23129, 26195, 37653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_7_15N[87][10] = {
-      {9, 460, 792, 1007, 4580, 11452, 13130, 26882, 27020, 32439},
-      {9, 35, 472, 1056, 7154, 12700, 13326, 13414, 16828, 19102},
-      {9, 45, 440, 772, 4854, 7863, 26945, 27684, 28651, 31875},
-      {9, 744, 812, 892, 1509, 9018, 12925, 14140, 21357, 25106},
-      {9, 271, 474, 761, 4268, 6706, 9609, 19701, 19707, 24870},
-      {9, 223, 477, 662, 1987, 9247, 18376, 22148, 24948, 27694},
-      {9, 44, 379, 786, 8823, 12322, 14666, 16377, 28688, 29924},
-      {9, 104, 219, 562, 5832, 19665, 20615, 21043, 22759, 32180},
-      {9, 41, 43, 870, 7963, 13718, 14136, 17216, 30470, 33428},
-      {9, 592, 744, 887, 4513, 6192, 18116, 19482, 25032, 34095},
-      {9, 456, 821, 1078, 7162, 7443, 8774, 15567, 17243, 33085},
-      {9, 151, 666, 977, 6946, 10358, 11172, 18129, 19777, 32234},
-      {9, 236, 793, 870, 2001, 6805, 9047, 13877, 30131, 34252},
-      {9, 297, 698, 772, 3449, 4204, 11608, 22950, 26071, 27512},
-      {9, 202, 428, 474, 3205, 3726, 6223, 7708, 20214, 25283},
-      {9, 139, 719, 915, 1447, 2938, 11864, 15932, 21748, 28598},
-      {9, 135, 853, 902, 3239, 18590, 20579, 30578, 33374, 34045},
-      {9, 9, 13, 971, 11834, 13642, 17628, 21669, 24741, 30965},
-      {9, 344, 531, 730, 1880, 16895, 17587, 21901, 28620, 31957},
-      {9, 7, 192, 380, 3168, 3729, 5518, 6827, 20372, 34168},
-      {9, 28, 521, 681, 4313, 7465, 14209, 21501, 23364, 25980},
-      {9, 269, 393, 898, 3561, 11066, 11985, 17311, 26127, 30309},
-      {9, 42, 82, 707, 4880, 4890, 9818, 23340, 25959, 31695},
-      {9, 189, 262, 707, 6573, 14082, 22259, 24230, 24390, 24664},
-      {9, 383, 568, 573, 5498, 13449, 13990, 16904, 22629, 34203},
-      {9, 585, 596, 820, 2440, 2488, 21956, 28261, 28703, 29591},
-      {9, 755, 763, 795, 5636, 16433, 21714, 23452, 31150, 34545},
-      {9, 23, 343, 669, 1159, 3507, 13096, 17978, 24241, 34321},
-      {9, 316, 384, 944, 4872, 8491, 18913, 21085, 23198, 24798},
-      {9, 64, 314, 765, 3706, 7136, 8634, 14227, 17127, 23437},
-      {9, 220, 693, 899, 8791, 12417, 13487, 18335, 22126, 27428},
-      {9, 285, 794, 1045, 8624, 8801, 9547, 19167, 21894, 32657},
-      {9, 386, 621, 1045, 1634, 1882, 3172, 13686, 16027, 22448},
-      {9, 95, 622, 693, 2827, 7098, 11452, 14112, 18831, 31308},
-      {9, 446, 813, 928, 7976, 8935, 13146, 27117, 27766, 33111},
-      {9, 89, 138, 241, 3218, 9283, 20458, 31484, 31538, 34216},
-      {9, 277, 420, 704, 9281, 12576, 12788, 14496, 15357, 20585},
-      {9, 141, 643, 758, 4894, 10264, 15144, 16357, 22478, 26461},
-      {9, 17, 108, 160, 13183, 15424, 17939, 19276, 23714, 26655},
-      {9, 109, 285, 608, 1682, 20223, 21791, 24615, 29622, 31983},
-      {9, 123, 515, 622, 7037, 13946, 15292, 15606, 16262, 23742},
-      {9, 264, 565, 923, 6460, 13622, 13934, 23181, 25475, 26134},
-      {9, 202, 548, 789, 8003, 10993, 12478, 16051, 25114, 27579},
-      {9, 121, 450, 575, 5972, 10062, 18693, 21852, 23874, 28031},
-      {9, 507, 560, 889, 12064, 13316, 19629, 21547, 25461, 28732},
-      {9, 664, 786, 1043, 9137, 9294, 10163, 23389, 31436, 34297},
-      {9, 45, 830, 907, 10730, 16541, 21232, 30354, 30605, 31847},
-      {9, 203, 507, 1060, 6971, 12216, 13321, 17861, 22671, 29825},
-      {9, 369, 881, 952, 3035, 12279, 12775, 17682, 17805, 34281},
-      {9, 683, 709, 1032, 3787, 17623, 24138, 26775, 31432, 33626},
-      {9, 524, 792, 1042, 12249, 14765, 18601, 25811, 32422, 33163},
-      {9, 137, 639, 688, 7182, 8169, 10443, 22530, 24597, 29039},
-      {9, 159, 643, 749, 16386, 17401, 24135, 28429, 33468, 33469},
-      {9, 107, 481, 555, 7322, 13234, 19344, 23498, 26581, 31378},
-      {9, 249, 389, 523, 3421, 10150, 17616, 19085, 20545, 32069},
-      {9, 395, 738, 1045, 2415, 3005, 3820, 19541, 23543, 31068},
-      {9, 27, 293, 703, 1717, 3460, 8326, 8501, 10290, 32625},
-      {9, 126, 247, 515, 6031, 9549, 10643, 22067, 29490, 34450},
-      {9, 331, 471, 1007, 3020, 3922, 7580, 23358, 28620, 30946},
-      {9, 222, 542, 1021, 3291, 3652, 13130, 16349, 33009, 34348},
-      {9, 532, 719, 1038, 5891, 7528, 23252, 25472, 31395, 31774},
-      {9, 145, 398, 774, 7816, 13887, 14936, 23708, 31712, 33160},
-      {9, 88, 536, 600, 1239, 1887, 12195, 13782, 16726, 27998},
-      {9, 151, 269, 585, 1445, 3178, 3970, 15568, 20358, 21051},
-      {9, 650, 819, 865, 15567, 18546, 25571, 32038, 33350, 33620},
-      {9, 93, 469, 800, 6059, 10405, 12296, 17515, 21354, 22231},
-      {9, 97, 206, 951, 6161, 16376, 27022, 29192, 30190, 30665},
-      {9, 412, 549, 986, 5833, 10583, 10766, 24946, 28878, 31937},
-      {9, 72, 604, 659, 5267, 12227, 21714, 32120, 33472, 33974},
-      {9, 25, 902, 912, 1137, 2975, 9642, 11598, 25919, 28278},
-      {9, 420, 976, 1055, 8473, 11512, 20198, 21662, 25443, 30119},
-      {9, 1, 24, 932, 6426, 11899, 13217, 13935, 16548, 29737},
-      {9, 53, 618, 988, 6280, 7267, 11676, 13575, 15532, 25787},
-      {9, 111, 739, 809, 8133, 12717, 12741, 20253, 20608, 27850},
-      {9, 120, 683, 943, 14496, 15162, 15440, 18660, 27543, 32404},
-      {8, 600, 754, 1055, 7873, 9679, 17351, 27268, 33508, 0},
-      {8, 344, 756, 1054, 7102, 7193, 22903, 24720, 27883, 0},
-      {8, 582, 1003, 1046, 11344, 23756, 27497, 27977, 32853, 0},
-      {8, 28, 429, 509, 11106, 11767, 12729, 13100, 31792, 0},
-      {8, 131, 555, 907, 5113, 10259, 10300, 20580, 23029, 0},
-      {8, 406, 915, 977, 12244, 20259, 26616, 27899, 32228, 0},
-      {8, 46, 195, 224, 1229, 4116, 10263, 13608, 17830, 0},
-      {8, 19, 819, 953, 7965, 9998, 13959, 30580, 30754, 0},
-      {8, 164, 1003, 1032, 12920, 15975, 16582, 22624, 27357, 0},
-      {6, 8433, 11894, 13531, 17675, 25889, 31384, 0, 0, 0},
-      {6, 3166, 3813, 8596, 10368, 25104, 29584, 0, 0, 0},
-      {6, 2466, 8241, 12424, 13376, 24837, 32711, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_8_15N[96][20] = {
-      {19, 2768, 3039, 4059, 5856, 6245, 7013, 8157, 9341, 9802, 10470, 11521, 12083, 16610, 18361, 20321, 24601, 27420, 28206, 29788},
-      {19, 2739, 8244, 8891, 9157, 12624, 12973, 15534, 16622, 16919, 18402, 18780, 19854, 20220, 20543, 22306, 25540, 27478, 27678, 28053},
-      {19, 1727, 2268, 6246, 7815, 9010, 9556, 10134, 10472, 11389, 14599, 15719, 16204, 17342, 17666, 18850, 22058, 25579, 25860, 29207},
-      {19, 28, 1346, 3721, 5565, 7019, 9240, 12355, 13109, 14800, 16040, 16839, 17369, 17631, 19357, 19473, 19891, 20381, 23911, 29683},
-      {19, 869, 2450, 4386, 5316, 6160, 7107, 10362, 11132, 11271, 13149, 16397, 16532, 17113, 19894, 22043, 22784, 27383, 28615, 28804},
-      {19, 508, 4292, 5831, 8559, 10044, 10412, 11283, 14810, 15888, 17243, 17538, 19903, 20528, 22090, 22652, 27235, 27384, 28208, 28485},
-      {19, 389, 2248, 5840, 6043, 7000, 9054, 11075, 11760, 12217, 12565, 13587, 15403, 19422, 19528, 21493, 25142, 27777, 28566, 28702},
-      {19, 1015, 2002, 5764, 6777, 9346, 9629, 11039, 11153, 12690, 13068, 13990, 16841, 17702, 20021, 24106, 26300, 29332, 30081, 30196},
-      {19, 1480, 3084, 3467, 4401, 4798, 5187, 7851, 11368, 12323, 14325, 14546, 16360, 17158, 18010, 21333, 25612, 26556, 26906, 27005},
-      {19, 6925, 8876, 12392, 14529, 15253, 15437, 19226, 19950, 20321, 23021, 23651, 24393, 24653, 26668, 27205, 28269, 28529, 29041, 29292},
-      {19, 2547, 3404, 3538, 4666, 5126, 5468, 7695, 8799, 14732, 15072, 15881, 17410, 18971, 19609, 19717, 22150, 24941, 27908, 29018},
-      {19, 888, 1581, 2311, 5511, 7218, 9107, 10454, 12252, 13662, 15714, 15894, 17025, 18671, 24304, 25316, 25556, 28489, 28977, 29212},
-      {19, 1047, 1494, 1718, 4645, 5030, 6811, 7868, 8146, 10611, 15767, 17682, 18391, 22614, 23021, 23763, 25478, 26491, 29088, 29757},
-      {19, 59, 1781, 1900, 3814, 4121, 8044, 8906, 9175, 11156, 14841, 15789, 16033, 16755, 17292, 18550, 19310, 22505, 29567, 29850},
-      {19, 1952, 3057, 4399, 9476, 10171, 10769, 11335, 11569, 15002, 19501, 20621, 22642, 23452, 24360, 25109, 25290, 25828, 28505, 29122},
-      {19, 2895, 3070, 3437, 4764, 4905, 6670, 9244, 11845, 13352, 13573, 13975, 14600, 15871, 17996, 19672, 20079, 20579, 25327, 27958},
-      {19, 612, 1528, 2004, 4244, 4599, 4926, 5843, 7684, 10122, 10443, 12267, 14368, 18413, 19058, 22985, 24257, 26202, 26596, 27899},
-      {19, 1361, 2195, 4146, 6708, 7158, 7538, 9138, 9998, 14862, 15359, 16076, 18925, 21401, 21573, 22503, 24146, 24247, 27778, 29312},
-      {19, 5229, 6235, 7134, 7655, 9139, 13527, 15408, 16058, 16705, 18320, 19909, 20901, 22238, 22437, 23654, 25131, 27550, 28247, 29903},
-      {19, 697, 2035, 4887, 5275, 6909, 9166, 11805, 15338, 16381, 18403, 20425, 20688, 21547, 24590, 25171, 26726, 28848, 29224, 29412},
-      {4, 5379, 17329, 22659, 23062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 11814, 14759, 22329, 22936, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2423, 2811, 10296, 12727, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 8460, 15260, 16769, 17290, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 14191, 14608, 29536, 30187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 7103, 10069, 20111, 22850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4285, 15413, 26448, 29069, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 548, 2137, 9189, 10928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4581, 7077, 23382, 23949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 3942, 17248, 19486, 27922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 8668, 10230, 16922, 26678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6158, 9980, 13788, 28198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 12422, 16076, 24206, 29887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 8778, 10649, 18747, 22111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 21029, 22677, 27150, 28980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 7918, 15423, 27672, 27803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5927, 18086, 23525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3397, 15058, 30224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 24016, 25880, 26268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1096, 4775, 7912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3259, 17301, 20802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 129, 8396, 15132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 17825, 28119, 28676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2343, 8382, 28840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3907, 18374, 20939, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1132, 1290, 8786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1481, 4710, 28846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2185, 3705, 26834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5496, 15681, 21854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12697, 13407, 22178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12788, 21227, 22894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 629, 2854, 6232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2289, 18227, 27458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7593, 21935, 23001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3836, 7081, 12282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7925, 18440, 23135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 497, 6342, 9717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11199, 22046, 30067, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12572, 28045, 28990, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1240, 2023, 10933, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 19566, 20629, 25186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6442, 13303, 28813, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4765, 10572, 16180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 552, 19301, 24286, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6782, 18480, 21383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11267, 12288, 15758, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 771, 5652, 15531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16131, 20047, 25649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13227, 23035, 24450, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4839, 13467, 27488, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2852, 4677, 22993, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2504, 28116, 29524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12518, 17374, 24267, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1222, 11859, 27922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9660, 17286, 18261, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 232, 11296, 29978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9750, 11165, 16295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4894, 9505, 23622, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10861, 11980, 14110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2128, 15883, 22836, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6274, 17243, 21989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10866, 13202, 22517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11159, 16111, 21608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3719, 18787, 22100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1756, 2020, 23901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 20913, 29473, 30103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2729, 15091, 26976, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4410, 8217, 12963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5395, 24564, 28235, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3859, 17909, 23051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5733, 26005, 29797, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1935, 3492, 29773, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11903, 21380, 29914, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6091, 10469, 29997, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2895, 8930, 15594, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1827, 10028, 20070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_9_15N[108][20] = {
-      {19, 113, 1557, 3316, 5680, 6241, 10407, 13404, 13947, 14040, 14353, 15522, 15698, 16079, 17363, 19374, 19543, 20530, 22833, 24339},
-      {19, 271, 1361, 6236, 7006, 7307, 7333, 12768, 15441, 15568, 17923, 18341, 20321, 21502, 22023, 23938, 25351, 25590, 25876, 25910},
-      {19, 73, 605, 872, 4008, 6279, 7653, 10346, 10799, 12482, 12935, 13604, 15909, 16526, 19782, 20506, 22804, 23629, 24859, 25600},
-      {19, 1445, 1690, 4304, 4851, 8919, 9176, 9252, 13783, 16076, 16675, 17274, 18806, 18882, 20819, 21958, 22451, 23869, 23999, 24177},
-      {19, 1290, 2337, 5661, 6371, 8996, 10102, 10941, 11360, 12242, 14918, 16808, 20571, 23374, 24046, 25045, 25060, 25662, 25783, 25913},
-      {19, 28, 42, 1926, 3421, 3503, 8558, 9453, 10168, 15820, 17473, 19571, 19685, 22790, 23336, 23367, 23890, 24061, 25657, 25680},
-      {19, 0, 1709, 4041, 4932, 5968, 7123, 8430, 9564, 10596, 11026, 14761, 19484, 20762, 20858, 23803, 24016, 24795, 25853, 25863},
-      {19, 29, 1625, 6500, 6609, 16831, 18517, 18568, 18738, 19387, 20159, 20544, 21603, 21941, 24137, 24269, 24416, 24803, 25154, 25395},
-      {19, 55, 66, 871, 3700, 11426, 13221, 15001, 16367, 17601, 18380, 22796, 23488, 23938, 25476, 25635, 25678, 25807, 25857, 25872},
-      {19, 1, 19, 5958, 8548, 8860, 11489, 16845, 18450, 18469, 19496, 20190, 23173, 25262, 25566, 25668, 25679, 25858, 25888, 25915},
-      {19, 7520, 7690, 8855, 9183, 14654, 16695, 17121, 17854, 18083, 18428, 19633, 20470, 20736, 21720, 22335, 23273, 25083, 25293, 25403},
-      {19, 48, 58, 410, 1299, 3786, 10668, 18523, 18963, 20864, 22106, 22308, 23033, 23107, 23128, 23990, 24286, 24409, 24595, 25802},
-      {19, 12, 51, 3894, 6539, 8276, 10885, 11644, 12777, 13427, 14039, 15954, 17078, 19053, 20537, 22863, 24521, 25087, 25463, 25838},
-      {19, 3509, 8748, 9581, 11509, 15884, 16230, 17583, 19264, 20900, 21001, 21310, 22547, 22756, 22959, 24768, 24814, 25594, 25626, 25880},
-      {19, 21, 29, 69, 1448, 2386, 4601, 6626, 6667, 10242, 13141, 13852, 14137, 18640, 19951, 22449, 23454, 24431, 25512, 25814},
-      {19, 18, 53, 7890, 9934, 10063, 16728, 19040, 19809, 20825, 21522, 21800, 23582, 24556, 25031, 25547, 25562, 25733, 25789, 25906},
-      {19, 4096, 4582, 5766, 5894, 6517, 10027, 12182, 13247, 15207, 17041, 18958, 20133, 20503, 22228, 24332, 24613, 25689, 25855, 25883},
-      {19, 0, 25, 819, 5539, 7076, 7536, 7695, 9532, 13668, 15051, 17683, 19665, 20253, 21996, 24136, 24890, 25758, 25784, 25807},
-      {19, 34, 40, 44, 4215, 6076, 7427, 7965, 8777, 11017, 15593, 19542, 22202, 22973, 23397, 23423, 24418, 24873, 25107, 25644},
-      {4, 1595, 6216, 22850, 25439, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1562, 15172, 19517, 22362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 7508, 12879, 24324, 24496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6298, 15819, 16757, 18721, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 11173, 15175, 19966, 21195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 59, 13505, 16941, 23793, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2267, 4830, 12023, 20587, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 8827, 9278, 13072, 16664, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 14419, 17463, 23398, 25348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6112, 16534, 20423, 22698, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 493, 8914, 21103, 24799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6896, 12761, 13206, 25873, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2, 1380, 12322, 21701, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 11600, 21306, 25753, 25790, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 8421, 13076, 14271, 15401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 9630, 14112, 19017, 20955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 212, 13932, 21781, 25824, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 5961, 9110, 16654, 19636, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 58, 5434, 9936, 12770, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6575, 11433, 19798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2731, 7338, 20926, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14253, 18463, 25404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 21791, 24805, 25869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2, 11646, 15850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6075, 8586, 23819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 18435, 22093, 24852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2103, 2368, 11704, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10925, 17402, 18232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9062, 25061, 25674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 18497, 20853, 23404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 18606, 19364, 19551, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7, 1022, 25543, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6744, 15481, 25868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9081, 17305, 25164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8, 23701, 25883, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9680, 19955, 22848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 56, 4564, 19121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5595, 15086, 25892, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3174, 17127, 23183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 19397, 19817, 20275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12561, 24571, 25825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7111, 9889, 25865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 19104, 20189, 21851, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 549, 9686, 25548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6586, 20325, 25906, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3224, 20710, 21637, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 641, 15215, 25754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13484, 23729, 25818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2043, 7493, 24246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16860, 25230, 25768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 22047, 24200, 24902, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9391, 18040, 19499, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7855, 24336, 25069, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 23834, 25570, 25852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1977, 8800, 25756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6671, 21772, 25859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3279, 6710, 24444, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 24099, 25117, 25820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5553, 12306, 25915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 48, 11107, 23907, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10832, 11974, 25773, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2223, 17905, 25484, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16782, 17135, 20446, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 475, 2861, 3457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16218, 22449, 24362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11716, 22200, 25897, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8315, 15009, 22633, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13, 20480, 25852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12352, 18658, 25687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3681, 14794, 23703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 30, 24531, 25846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4103, 22077, 24107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 23837, 25622, 25812, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3627, 13387, 25839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 908, 5367, 19388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 0, 6894, 25795, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 20322, 23546, 25181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8178, 25260, 25437, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2449, 13244, 22565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 31, 18928, 22741, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1312, 5134, 14838, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6085, 13937, 24220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 66, 14633, 25670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 47, 22512, 25472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8867, 24704, 25279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6742, 21623, 22745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 147, 9948, 24178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8522, 24261, 24307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 19202, 22406, 24609, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_10_15N[120][15] = {
-      {14, 316, 1271, 3692, 9495, 12147, 12849, 14928, 16671, 16938, 17864, 19108, 20502, 21097, 21115},
-      {14, 2341, 2559, 2643, 2816, 2865, 5137, 5331, 7000, 7523, 8023, 10439, 10797, 13208, 15041},
-      {14, 5556, 6858, 7677, 10162, 10207, 11349, 12321, 12398, 14787, 15743, 15859, 15952, 19313, 20879},
-      {14, 349, 573, 910, 2702, 3654, 6214, 9246, 9353, 10638, 11772, 14447, 14953, 16620, 19888},
-      {14, 204, 1390, 2887, 3835, 6230, 6533, 7443, 7876, 9299, 10291, 10896, 13960, 18287, 20086},
-      {14, 541, 2429, 2838, 7144, 8523, 8637, 10490, 10585, 11074, 12074, 15762, 16812, 17900, 18548},
-      {14, 733, 1659, 3838, 5323, 5805, 7882, 9429, 10682, 13697, 16909, 18846, 19587, 19592, 20904},
-      {14, 1134, 2136, 4631, 4653, 4718, 5197, 10410, 11666, 14996, 15305, 16048, 17417, 18960, 20303},
-      {14, 734, 1001, 1283, 4959, 10016, 10176, 10973, 11578, 12051, 15550, 15915, 19022, 19430, 20121},
-      {14, 745, 4057, 5855, 9885, 10594, 10989, 13156, 13219, 13351, 13631, 13685, 14577, 17713, 20386},
-      {14, 968, 1446, 2130, 2502, 3092, 3787, 5323, 8104, 8418, 9998, 11681, 13972, 17747, 17929},
-      {14, 3020, 3857, 5275, 5786, 6319, 8608, 11943, 14062, 17144, 17752, 18001, 18453, 19311, 21414},
-      {14, 709, 747, 1038, 2181, 5320, 8292, 10584, 10859, 13964, 15009, 15277, 16953, 20675, 21509},
-      {14, 1663, 3247, 5003, 5760, 7186, 7360, 10346, 14211, 14717, 14792, 15155, 16128, 17355, 17970},
-      {14, 516, 578, 1914, 6147, 9419, 11148, 11434, 13289, 13325, 13332, 19106, 19257, 20962, 21556},
-      {14, 5009, 5632, 6531, 9430, 9886, 10621, 11765, 13969, 16178, 16413, 18110, 18249, 20616, 20759},
-      {14, 457, 2686, 3318, 4608, 5620, 5858, 6480, 7430, 9602, 12691, 14664, 18777, 20152, 20848},
-      {14, 33, 2877, 5334, 6851, 7907, 8654, 10688, 15401, 16123, 17942, 17969, 18747, 18931, 20224},
-      {14, 87, 897, 7636, 8663, 11425, 12288, 12672, 14199, 16435, 17615, 17950, 18953, 19667, 20281},
-      {14, 1042, 1832, 2545, 2719, 2947, 3672, 3700, 6249, 6398, 6833, 11114, 14283, 17694, 20477},
-      {14, 326, 488, 2662, 2880, 3009, 5357, 6587, 8882, 11604, 14374, 18781, 19051, 19057, 20508},
-      {14, 854, 1294, 2436, 2852, 4903, 6466, 7761, 9072, 9564, 10321, 13638, 15658, 16946, 19119},
-      {14, 194, 899, 1711, 2408, 2786, 5391, 7108, 8079, 8716, 11453, 17303, 19484, 20989, 21389},
-      {14, 1631, 3121, 3994, 5005, 7810, 8850, 10315, 10589, 13407, 17162, 18624, 18758, 19311, 20301},
-      {9, 736, 2424, 4792, 5600, 6370, 10061, 16053, 16775, 18600, 0, 0, 0, 0, 0},
-      {9, 1254, 8163, 8876, 9157, 12141, 14587, 16545, 17175, 18191, 0, 0, 0, 0, 0},
-      {9, 388, 6641, 8974, 10607, 10716, 14477, 16825, 17191, 18400, 0, 0, 0, 0, 0},
-      {9, 5578, 6082, 6824, 7360, 7745, 8655, 11402, 11665, 12428, 0, 0, 0, 0, 0},
-      {9, 3603, 8729, 13463, 14698, 15210, 19112, 19550, 20727, 21052, 0, 0, 0, 0, 0},
-      {9, 48, 1732, 3805, 5158, 15442, 16909, 19854, 21071, 21579, 0, 0, 0, 0, 0},
-      {3, 11707, 14014, 21531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1542, 4133, 4925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10083, 13505, 21198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14300, 15765, 16752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 778, 1237, 11215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1325, 3199, 14534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2007, 14510, 20599, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1996, 5881, 16429, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5111, 15018, 15980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4989, 10681, 12810, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3763, 10715, 16515, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2259, 10080, 15642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9032, 11319, 21305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3915, 15213, 20884, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11150, 15022, 20201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1147, 6749, 19625, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12139, 12939, 18870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3840, 4634, 10244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1018, 10231, 17720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2708, 13056, 13393, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5781, 11588, 18888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1345, 2036, 5252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5908, 8143, 15141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1804, 13693, 18640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10433, 13965, 16950, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9568, 10122, 15945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 547, 6722, 14015, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 321, 12844, 14095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2632, 10513, 14936, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6369, 11995, 20321, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9920, 19136, 21529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1990, 2726, 10183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5763, 12118, 15467, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 503, 10006, 19564, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9839, 11942, 19472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11205, 13552, 15389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8841, 13797, 19697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 124, 6053, 18224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6477, 14406, 21146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1224, 8027, 16011, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3046, 4422, 17717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 739, 12308, 17760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4014, 4130, 7835, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2266, 5652, 11981, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2711, 7970, 18317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2196, 15229, 17217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8636, 13302, 16764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5612, 15010, 16657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 615, 1249, 4639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3821, 12073, 18506, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1066, 16522, 21536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11307, 18363, 19740, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3240, 8560, 10391, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3124, 11424, 20779, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1604, 8861, 17394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2083, 7400, 8093, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3218, 7454, 9155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9855, 15998, 20533, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 316, 2850, 20652, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5583, 9768, 10333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7147, 7713, 18339, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12607, 17428, 21418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14216, 16954, 18164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8477, 15970, 18488, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1632, 8032, 9751, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4573, 9080, 13507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11747, 12441, 13876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1183, 15605, 16675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4408, 10264, 17109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5495, 7882, 12150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1010, 3763, 5065, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9828, 18054, 21599, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6342, 7353, 15358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6362, 9462, 19999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7184, 13693, 17622, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4343, 4654, 10995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7099, 8466, 18520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11505, 14395, 15138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6779, 16691, 18726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7146, 12644, 20196, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5865, 16728, 19634, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4657, 8714, 21246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4580, 5279, 18750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3767, 6620, 18905, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9209, 13093, 17575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12486, 15875, 19791, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8046, 14636, 17491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2120, 4643, 13206, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6186, 9675, 12601, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 784, 5770, 21585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_11_15N[132][16] = {
-      {15, 696, 989, 1238, 3091, 3116, 3738, 4269, 6406, 7033, 8048, 9157, 10254, 12033, 16456, 16912},
-      {15, 444, 1488, 6541, 8626, 10735, 12447, 13111, 13706, 14135, 15195, 15947, 16453, 16916, 17137, 17268},
-      {15, 401, 460, 992, 1145, 1576, 1678, 2238, 2320, 4280, 6770, 10027, 12486, 15363, 16714, 17157},
-      {15, 1161, 3108, 3727, 4508, 5092, 5348, 5582, 7727, 11793, 12515, 12917, 13362, 14247, 16717, 17205},
-      {15, 542, 1190, 6883, 7911, 8349, 8835, 10489, 11631, 14195, 15009, 15454, 15482, 16632, 17040, 17063},
-      {15, 17, 487, 776, 880, 5077, 6172, 9771, 11446, 12798, 16016, 16109, 16171, 17087, 17132, 17226},
-      {15, 1337, 3275, 3462, 4229, 9246, 10180, 10845, 10866, 12250, 13633, 14482, 16024, 16812, 17186, 17241},
-      {15, 15, 980, 2305, 3674, 5971, 8224, 11499, 11752, 11770, 12897, 14082, 14836, 15311, 16391, 17209},
-      {15, 0, 3926, 5869, 8696, 9351, 9391, 11371, 14052, 14172, 14636, 14974, 16619, 16961, 17033, 17237},
-      {15, 3033, 5317, 6501, 8579, 10698, 12168, 12966, 14019, 15392, 15806, 15991, 16493, 16690, 17062, 17090},
-      {15, 981, 1205, 4400, 6410, 11003, 13319, 13405, 14695, 15846, 16297, 16492, 16563, 16616, 16862, 16953},
-      {15, 1725, 4276, 8869, 9588, 14062, 14486, 15474, 15548, 16300, 16432, 17042, 17050, 17060, 17175, 17273},
-      {15, 1807, 5921, 9960, 10011, 14305, 14490, 14872, 15852, 16054, 16061, 16306, 16799, 16833, 17136, 17262},
-      {15, 2826, 4752, 6017, 6540, 7016, 8201, 14245, 14419, 14716, 15983, 16569, 16652, 17171, 17179, 17247},
-      {15, 1662, 2516, 3345, 5229, 8086, 9686, 11456, 12210, 14595, 15808, 16011, 16421, 16825, 17112, 17195},
-      {15, 2890, 4821, 5987, 7226, 8823, 9869, 12468, 14694, 15352, 15805, 16075, 16462, 17102, 17251, 17263},
-      {15, 3751, 3890, 4382, 5720, 10281, 10411, 11350, 12721, 13121, 14127, 14980, 15202, 15335, 16735, 17123},
-      {15, 26, 30, 2805, 5457, 6630, 7188, 7477, 7556, 11065, 16608, 16859, 16909, 16943, 17030, 17103},
-      {15, 40, 4524, 5043, 5566, 9645, 10204, 10282, 11696, 13080, 14837, 15607, 16274, 17034, 17225, 17266},
-      {15, 904, 3157, 6284, 7151, 7984, 11712, 12887, 13767, 15547, 16099, 16753, 16829, 17044, 17250, 17259},
-      {15, 7, 311, 4876, 8334, 9249, 11267, 14072, 14559, 15003, 15235, 15686, 16331, 17177, 17238, 17253},
-      {15, 4410, 8066, 8596, 9631, 10369, 11249, 12610, 15769, 16791, 16960, 17018, 17037, 17062, 17165, 17204},
-      {15, 24, 8261, 9691, 10138, 11607, 12782, 12786, 13424, 13933, 15262, 15795, 16476, 17084, 17193, 17220},
-      {4, 88, 11622, 14705, 15890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 304, 2026, 2638, 6018, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1163, 4268, 11620, 17232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 9701, 11785, 14463, 17260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4118, 10952, 12224, 17006, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 3647, 10823, 11521, 12060, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1717, 3753, 9199, 11642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2187, 14280, 17220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14787, 16903, 17061, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 381, 3534, 4294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3149, 6947, 8323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12562, 16724, 16881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7289, 9997, 15306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5615, 13152, 17260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5666, 16926, 17027, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4190, 7798, 16831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4778, 10629, 17180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10001, 13884, 15453, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6, 2237, 8203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7831, 15144, 15160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9186, 17204, 17243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9435, 17168, 17237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 42, 5701, 17159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7812, 14259, 15715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 39, 4513, 6658, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 38, 9368, 11273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1119, 4785, 17182, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5620, 16521, 16729, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16, 6685, 17242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 210, 3452, 12383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 466, 14462, 16250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10548, 12633, 13962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1452, 6005, 16453, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 22, 4120, 13684, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5195, 11563, 16522, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5518, 16705, 17201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12233, 14552, 15471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6067, 13440, 17248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8660, 8967, 17061, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8673, 12176, 15051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5959, 15767, 16541, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3244, 12109, 12414, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 31, 15913, 16323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3270, 15686, 16653, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 24, 7346, 14675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12, 1531, 8740, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6228, 7565, 16667, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16936, 17122, 17162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4868, 8451, 13183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3714, 4451, 16919, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11313, 13801, 17132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 17070, 17191, 17242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1911, 11201, 17186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14, 17190, 17254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11760, 16008, 16832, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14543, 17033, 17278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16129, 16765, 17155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6891, 15561, 17007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12741, 14744, 17116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8992, 16661, 17277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1861, 11130, 16742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4822, 13331, 16192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13281, 14027, 14989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 38, 14887, 17141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10698, 13452, 15674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4, 2539, 16877, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 857, 17170, 17249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11449, 11906, 12867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 285, 14118, 16831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 15191, 17214, 17242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 39, 728, 16915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2469, 12969, 15579, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16644, 17151, 17164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2592, 8280, 10448, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9236, 12431, 17173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9064, 16892, 17233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4526, 16146, 17038, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 31, 2116, 16083, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 15837, 16951, 17031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5362, 8382, 16618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6137, 13199, 17221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2841, 15068, 17068, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 24, 3620, 17003, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9880, 15718, 16764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1784, 10240, 17209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2731, 10293, 10846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3121, 8723, 16598, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8563, 15662, 17088, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13, 1167, 14676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 29, 13850, 15963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3654, 7553, 8114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 23, 4362, 14865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4434, 14741, 16688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8362, 13901, 17244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13687, 16736, 17232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 46, 4229, 13394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13169, 16383, 16972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16031, 16681, 16952, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3384, 9894, 12580, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9841, 14414, 16165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5013, 17099, 17115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2130, 8941, 17266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6907, 15428, 17241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16, 1860, 17235, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2151, 16014, 16643, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14954, 15958, 17222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3969, 8419, 15116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 31, 15593, 16984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 11514, 16605, 17255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_12_15N[144][15] = {
-      {14, 584, 1472, 1621, 1867, 3338, 3568, 3723, 4185, 5126, 5889, 7737, 8632, 8940, 9725},
-      {14, 221, 445, 590, 3779, 3835, 6939, 7743, 8280, 8448, 8491, 9367, 10042, 11242, 12917},
-      {14, 4662, 4837, 4900, 5029, 6449, 6687, 6751, 8684, 9936, 11681, 11811, 11886, 12089, 12909},
-      {14, 2418, 3018, 3647, 4210, 4473, 7447, 7502, 9490, 10067, 11092, 11139, 11256, 12201, 12383},
-      {14, 2591, 2947, 3349, 3406, 4417, 4519, 5176, 6672, 8498, 8863, 9201, 11294, 11376, 12184},
-      {14, 27, 101, 197, 290, 871, 1727, 3911, 5411, 6676, 8701, 9350, 10310, 10798, 12439},
-      {14, 1765, 1897, 2923, 3584, 3901, 4048, 6963, 7054, 7132, 9165, 10184, 10824, 11278, 12669},
-      {14, 2183, 3740, 4808, 5217, 5660, 6375, 6787, 8219, 8466, 9037, 10353, 10583, 11118, 12762},
-      {14, 73, 1594, 2146, 2715, 3501, 3572, 3639, 3725, 6959, 7187, 8406, 10120, 10507, 10691},
-      {14, 240, 732, 1215, 2185, 2788, 2830, 3499, 3881, 4197, 4991, 6425, 7061, 9756, 10491},
-      {14, 831, 1568, 1828, 3424, 4319, 4516, 4639, 6018, 9702, 10203, 10417, 11240, 11518, 12458},
-      {14, 2024, 2970, 3048, 3638, 3676, 4152, 5284, 5779, 5926, 9426, 9945, 10873, 11787, 11837},
-      {14, 1049, 1218, 1651, 2328, 3493, 4363, 5750, 6483, 7613, 8782, 9738, 9803, 11744, 11937},
-      {14, 1193, 2060, 2289, 2964, 3478, 4592, 4756, 6709, 7162, 8231, 8326, 11140, 11908, 12243},
-      {14, 978, 2120, 2439, 3338, 3850, 4589, 6567, 8745, 9656, 9708, 10161, 10542, 10711, 12639},
-      {14, 2403, 2938, 3117, 3247, 3711, 5593, 5844, 5932, 7801, 10152, 10226, 11498, 12162, 12941},
-      {14, 1781, 2229, 2276, 2533, 3582, 3951, 5279, 5774, 7930, 9824, 10920, 11038, 12340, 12440},
-      {14, 289, 384, 1980, 2230, 3464, 3873, 5958, 8656, 8942, 9006, 10175, 11425, 11745, 12530},
-      {14, 155, 354, 1090, 1330, 2002, 2236, 3559, 3705, 4922, 5958, 6576, 8564, 9972, 12760},
-      {14, 303, 876, 2059, 2142, 5244, 5330, 6644, 7576, 8614, 9598, 10410, 10718, 11033, 12957},
-      {14, 3449, 3617, 4408, 4602, 4727, 6182, 8835, 8928, 9372, 9644, 10237, 10747, 11655, 12747},
-      {14, 811, 2565, 2820, 8677, 8974, 9632, 11069, 11548, 11839, 12107, 12411, 12695, 12812, 12890},
-      {14, 972, 4123, 4943, 6385, 6449, 7339, 7477, 8379, 9177, 9359, 10074, 11709, 12552, 12831},
-      {14, 842, 973, 1541, 2262, 2905, 5276, 6758, 7099, 7894, 8128, 8325, 8663, 8875, 10050},
-      {14, 474, 791, 968, 3902, 4924, 4965, 5085, 5908, 6109, 6329, 7931, 9038, 9401, 10568},
-      {14, 1397, 4461, 4658, 5911, 6037, 7127, 7318, 8678, 8924, 9000, 9473, 9602, 10446, 12692},
-      {3, 1334, 7571, 12881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1393, 1447, 7972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 633, 1257, 10597, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4843, 5102, 11056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3294, 8015, 10513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1108, 10374, 10546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5353, 7824, 10111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3398, 7674, 8569, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7719, 9478, 10503, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2997, 9418, 9581, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5777, 6519, 11229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1966, 5214, 9899, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6, 4088, 5827, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 836, 9248, 9612, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 483, 7229, 7548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7865, 8289, 9804, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2915, 11098, 11900, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6180, 7096, 9481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1431, 6786, 8924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 748, 6757, 8625, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3312, 4475, 7204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1852, 8958, 11020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1915, 2903, 4006, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6776, 10886, 12531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2594, 9998, 12742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 159, 2002, 12079, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 853, 3281, 3762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5201, 5798, 6413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3882, 6062, 12047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4133, 6775, 9657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 228, 6874, 11183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7433, 10728, 10864, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7735, 8073, 12734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2844, 4621, 11779, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3909, 7103, 12804, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6002, 9704, 11060, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5864, 6856, 7681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3652, 5869, 7605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2546, 2657, 4461, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2423, 4203, 9111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 244, 1855, 4691, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1106, 2178, 6371, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 391, 1617, 10126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 250, 9259, 10603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3435, 4614, 6924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1742, 8045, 9529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7667, 8875, 11451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4023, 6108, 6911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8621, 10184, 11650, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6726, 10861, 12348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3228, 6302, 7388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1, 1137, 5358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 381, 2424, 8537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3256, 7508, 10044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1980, 2219, 4569, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2468, 5699, 10319, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2803, 3314, 12808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8578, 9642, 11533, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 829, 4585, 7923, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 59, 329, 5575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1067, 5709, 6867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1175, 4744, 12219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 109, 2518, 6756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2105, 10626, 11153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5192, 10696, 10749, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6260, 7641, 8233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2998, 3094, 11214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3398, 6466, 11494, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6574, 10448, 12160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2734, 10755, 12780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1028, 7958, 10825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8545, 8602, 10793, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 392, 3398, 11417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6639, 9291, 12571, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1067, 7919, 8934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1064, 2848, 12753, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6076, 8656, 12690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5504, 6193, 10171, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1951, 7156, 7356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4389, 4780, 7889, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 526, 4804, 9141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1238, 3648, 10464, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2587, 5624, 12557, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5560, 5903, 11963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1134, 2570, 3297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10041, 11583, 12157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1263, 9585, 12912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3744, 7898, 10646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 45, 9074, 10315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1051, 6188, 10038, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2242, 8394, 12712, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3598, 9025, 12651, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2295, 3540, 5610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1914, 4378, 12423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1766, 3635, 12759, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5177, 9586, 11143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 943, 3590, 11649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4864, 6905, 10454, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5852, 6042, 10421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6095, 8285, 12349, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2070, 7171, 8563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 718, 12234, 12716, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 512, 10667, 11353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3629, 6485, 7040, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2880, 8865, 11466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4490, 10220, 11796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5440, 8819, 9103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5262, 7543, 12411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 516, 7779, 10940, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2515, 5843, 9202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4684, 5994, 10586, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 573, 2270, 3324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7870, 8317, 10322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6856, 7638, 12909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1583, 7669, 10781, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8141, 9085, 12555, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3903, 5485, 9992, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4467, 11998, 12904, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_13_15N[156][14] = {
-      {13, 142, 2307, 2598, 2650, 4028, 4434, 5781, 5881, 6016, 6323, 6681, 6698, 8125},
-      {13, 2932, 4928, 5248, 5256, 5983, 6773, 6828, 7789, 8426, 8494, 8534, 8539, 8583},
-      {13, 899, 3295, 3833, 5399, 6820, 7400, 7753, 7890, 8109, 8451, 8529, 8564, 8602},
-      {13, 21, 3060, 4720, 5429, 5636, 5927, 6966, 8110, 8170, 8247, 8355, 8365, 8616},
-      {13, 20, 1745, 2838, 3799, 4380, 4418, 4646, 5059, 7343, 8161, 8302, 8456, 8631},
-      {13, 9, 6274, 6725, 6792, 7195, 7333, 8027, 8186, 8209, 8273, 8442, 8548, 8632},
-      {13, 494, 1365, 2405, 3799, 5188, 5291, 7644, 7926, 8139, 8458, 8504, 8594, 8625},
-      {13, 192, 574, 1179, 4387, 4695, 5089, 5831, 7673, 7789, 8298, 8301, 8612, 8632},
-      {13, 11, 20, 1406, 6111, 6176, 6256, 6708, 6834, 7828, 8232, 8457, 8495, 8602},
-      {13, 6, 2654, 3554, 4483, 4966, 5866, 6795, 8069, 8249, 8301, 8497, 8509, 8623},
-      {13, 21, 1144, 2355, 3124, 6773, 6805, 6887, 7742, 7994, 8358, 8374, 8580, 8611},
-      {13, 335, 4473, 4883, 5528, 6096, 7543, 7586, 7921, 8197, 8319, 8394, 8489, 8636},
-      {13, 2919, 4331, 4419, 4735, 6366, 6393, 6844, 7193, 8165, 8205, 8544, 8586, 8617},
-      {13, 12, 19, 742, 930, 3009, 4330, 6213, 6224, 7292, 7430, 7792, 7922, 8137},
-      {13, 710, 1439, 1588, 2434, 3516, 5239, 6248, 6827, 8230, 8448, 8515, 8581, 8619},
-      {13, 200, 1075, 1868, 5581, 7349, 7642, 7698, 8037, 8201, 8210, 8320, 8391, 8526},
-      {13, 3, 2501, 4252, 5256, 5292, 5567, 6136, 6321, 6430, 6486, 7571, 8521, 8636},
-      {13, 3062, 4599, 5885, 6529, 6616, 7314, 7319, 7567, 8024, 8153, 8302, 8372, 8598},
-      {13, 105, 381, 1574, 4351, 5452, 5603, 5943, 7467, 7788, 7933, 8362, 8513, 8587},
-      {13, 787, 1857, 3386, 3659, 6550, 7131, 7965, 8015, 8040, 8312, 8484, 8525, 8537},
-      {13, 15, 1118, 4226, 5197, 5575, 5761, 6762, 7038, 8260, 8338, 8444, 8512, 8568},
-      {13, 36, 5216, 5368, 5616, 6029, 6591, 8038, 8067, 8299, 8351, 8565, 8578, 8585},
-      {13, 1, 23, 4300, 4530, 5426, 5532, 5817, 6967, 7124, 7979, 8022, 8270, 8437},
-      {13, 629, 2133, 4828, 5475, 5875, 5890, 7194, 8042, 8345, 8385, 8518, 8598, 8612},
-      {13, 11, 1065, 3782, 4237, 4993, 7104, 7863, 7904, 8104, 8228, 8321, 8383, 8565},
-      {13, 2131, 2274, 3168, 3215, 3220, 5597, 6347, 7812, 8238, 8354, 8527, 8557, 8614},
-      {4, 5600, 6591, 7491, 7696, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1766, 8281, 8626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1725, 2280, 5120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1650, 3445, 7652, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4312, 6911, 8626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 15, 1013, 5892, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2263, 2546, 2979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1545, 5873, 7406, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 67, 726, 3697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2860, 6443, 8542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 17, 911, 2820, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1561, 4580, 6052, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 79, 5269, 7134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 22, 2410, 2424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3501, 5642, 8627, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 808, 6950, 8571, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4099, 6389, 7482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4023, 5000, 7833, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5476, 5765, 7917, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1008, 3194, 7207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 20, 495, 5411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1703, 8388, 8635, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6, 4395, 4921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 200, 2053, 8206, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1089, 5126, 5562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10, 4193, 7720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1967, 2151, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 22, 738, 3513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3385, 5066, 8152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 440, 1118, 8537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3429, 6058, 7716, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5213, 7519, 8382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5564, 8365, 8620, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 43, 3219, 8603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4, 5409, 5815, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5, 6376, 7654, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4091, 5724, 5953, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5348, 6754, 8613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1634, 6398, 6632, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 72, 2058, 8605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3497, 5811, 7579, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3846, 6743, 8559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 15, 5933, 8629, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2133, 5859, 7068, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4151, 4617, 8566, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2960, 8270, 8410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2059, 3617, 8210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 544, 1441, 6895, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4043, 7482, 8592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 294, 2180, 8524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3058, 8227, 8373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 364, 5756, 8617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5383, 8555, 8619, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1704, 2480, 4181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7338, 7929, 7990, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2615, 3905, 7981, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4298, 4548, 8296, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8262, 8319, 8630, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 892, 1893, 8028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5694, 7237, 8595, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1487, 5012, 5810, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4335, 8593, 8624, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3509, 4531, 5273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10, 22, 830, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4161, 5208, 6280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 275, 7063, 8634, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4, 2725, 3113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2279, 7403, 8174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1637, 3328, 3930, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2810, 4939, 5624, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3, 1234, 7687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2799, 7740, 8616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 22, 7701, 8636, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4302, 7857, 7993, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7477, 7794, 8592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9, 6111, 8591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5, 8606, 8628, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 347, 3497, 4033, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1747, 2613, 8636, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1827, 5600, 7042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 580, 1822, 6842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 232, 7134, 7783, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4629, 5000, 7231, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 951, 2806, 4947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 571, 3474, 8577, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2437, 2496, 7945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 23, 5873, 8162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 12, 1168, 7686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8315, 8540, 8596, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1766, 2506, 4733, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 929, 1516, 3338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 21, 1216, 6555, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 782, 1452, 8617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 8, 6083, 6087, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 667, 3240, 4583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4030, 4661, 5790, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 559, 7122, 8553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3202, 4388, 4909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2533, 3673, 8594, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1991, 3954, 6206, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6835, 7900, 7980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 189, 5722, 8573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2680, 4928, 4998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 243, 2579, 7735, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4281, 8132, 8566, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7656, 7671, 8609, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1116, 2291, 4166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 21, 388, 8021, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6, 1123, 8369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 311, 4918, 8511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 0, 3248, 6290, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13, 6762, 7172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4209, 5632, 7563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 49, 127, 8074, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 581, 1735, 4075, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 0, 2235, 5470, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2178, 5820, 6179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 16, 3575, 6054, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1095, 4564, 6458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9, 1581, 5953, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2537, 6469, 8552, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 14, 3874, 4844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 0, 3269, 3551, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2114, 7372, 7926, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1875, 2388, 4057, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3232, 4042, 6663, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9, 401, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 13, 4100, 6584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2299, 4190, 4410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 21, 3670, 4979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_2_15S[15][8] = {
-      {7, 2889, 3122, 3208, 4324, 5968, 7241, 13215},
-      {7, 281, 923, 1077, 5252, 6099, 10309, 11114},
-      {7, 727, 2413, 2676, 6151, 6796, 8945, 12528},
-      {7, 2252, 2322, 3093, 3329, 8443, 12170, 13748},
-      {7, 575, 2489, 2944, 6577, 8772, 11253, 11657},
-      {7, 310, 1461, 2482, 4643, 4780, 6936, 11970},
-      {4, 8691, 9746, 10794, 13582, 0, 0, 0},
-      {4, 3717, 6535, 12470, 12752, 0, 0, 0},
-      {4, 6011, 6547, 7020, 11746, 0, 0, 0},
-      {4, 5309, 6481, 10244, 13824, 0, 0, 0},
-      {4, 5327, 8773, 8824, 13343, 0, 0, 0},
-      {4, 3506, 3575, 9915, 13609, 0, 0, 0},
-      {4, 3393, 7089, 11048, 12816, 0, 0, 0},
-      {4, 3651, 4902, 6118, 12048, 0, 0, 0},
-      {4, 4210, 10132, 13375, 13377, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_3_15S[12][12] = {
-      {11, 8, 372, 841, 4522, 5253, 7430, 8542, 9822, 10550, 11896, 11988},
-      {11, 80, 255, 667, 1511, 3549, 5239, 5422, 5497, 7157, 7854, 11267},
-      {11, 257, 406, 792, 2916, 3072, 3214, 3638, 4090, 8175, 8892, 9003},
-      {11, 80, 150, 346, 1883, 6838, 7818, 9482, 10366, 10514, 11468, 12341},
-      {11, 32, 100, 978, 3493, 6751, 7787, 8496, 10170, 10318, 10451, 12561},
-      {11, 504, 803, 856, 2048, 6775, 7631, 8110, 8221, 8371, 9443, 10990},
-      {11, 152, 283, 696, 1164, 4514, 4649, 7260, 7370, 11925, 11986, 12092},
-      {11, 127, 1034, 1044, 1842, 3184, 3397, 5931, 7577, 11898, 12339, 12689},
-      {11, 107, 513, 979, 3934, 4374, 4658, 7286, 7809, 8830, 10804, 10893},
-      {10, 2045, 2499, 7197, 8887, 9420, 9922, 10132, 10540, 10816, 11876, 0},
-      {10, 2932, 6241, 7136, 7835, 8541, 9403, 9817, 11679, 12377, 12810, 0},
-      {10, 2211, 2288, 3937, 4310, 5952, 6597, 9692, 10445, 11064, 11272, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_4_15S[15][11] = {
-      {10, 19, 585, 710, 3241, 3276, 3648, 6345, 9224, 9890, 10841},
-      {10, 181, 494, 894, 2562, 3201, 4382, 5130, 5308, 6493, 10135},
-      {9, 150, 569, 919, 1427, 2347, 4475, 7857, 8904, 9903, 0},
-      {9, 1005, 1018, 1025, 2933, 3280, 3946, 4049, 4166, 5209, 0},
-      {9, 420, 554, 778, 6908, 7959, 8344, 8462, 10912, 11099, 0},
-      {9, 231, 506, 859, 4478, 4957, 7664, 7731, 7908, 8980, 0},
-      {9, 179, 537, 979, 3717, 5092, 6315, 6883, 9353, 9935, 0},
-      {9, 147, 205, 830, 3609, 3720, 4667, 7441, 10196, 11809, 0},
-      {9, 60, 1021, 1061, 1554, 4918, 5690, 6184, 7986, 11296, 0},
-      {9, 145, 719, 768, 2290, 2919, 7272, 8561, 9145, 10233, 0},
-      {9, 388, 590, 852, 1579, 1698, 1974, 9747, 10192, 10255, 0},
-      {9, 231, 343, 485, 1546, 3155, 4829, 7710, 10394, 11336, 0},
-      {7, 4381, 5398, 5987, 9123, 10365, 11018, 11153, 0, 0, 0},
-      {7, 2381, 5196, 6613, 6844, 7357, 8732, 11082, 0, 0, 0},
-      {7, 1730, 4599, 5693, 6318, 7626, 9231, 10663, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_5_15S[17][11] = {
-      {9, 69, 244, 706, 5145, 5994, 6066, 6763, 6815, 8509, 0},
-      {9, 257, 541, 618, 3933, 6188, 7048, 7484, 8424, 9104, 0},
-      {9, 69, 500, 536, 1494, 1669, 7075, 7553, 8202, 10305, 0},
-      {9, 11, 189, 340, 2103, 3199, 6775, 7471, 7918, 10530, 0},
-      {9, 333, 400, 434, 1806, 3264, 5693, 8534, 9274, 10344, 0},
-      {10, 111, 129, 260, 3562, 3676, 3680, 3809, 5169, 7308, 8280},
-      {10, 100, 303, 342, 3133, 3952, 4226, 4713, 5053, 5717, 9931},
-      {10, 83, 87, 374, 828, 2460, 4943, 6311, 8657, 9272, 9571},
-      {10, 114, 166, 325, 2680, 4698, 7703, 7886, 8791, 9978, 10684},
-      {10, 281, 542, 549, 1671, 3178, 3955, 7153, 7432, 9052, 10219},
-      {10, 202, 271, 608, 3860, 4173, 4203, 5169, 6871, 8113, 9757},
-      {10, 16, 359, 419, 3333, 4198, 4737, 6170, 7987, 9573, 10095},
-      {10, 235, 244, 584, 4640, 5007, 5563, 6029, 6816, 7678, 9968},
-      {10, 123, 449, 646, 2460, 3845, 4161, 6610, 7245, 7686, 8651},
-      {10, 136, 231, 468, 835, 2622, 3292, 5158, 5294, 6584, 9926},
-      {7, 3085, 4683, 8191, 9027, 9922, 9928, 10550, 0, 0, 0},
-      {7, 2462, 3185, 3976, 4091, 8089, 8772, 9342, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_6_15S[18][31] = {
-      {30, 27, 430, 519, 828, 1897, 1943, 2513, 2600, 2640, 3310, 3415, 4266, 5044, 5100, 5328, 5483, 5928, 6204, 6392, 6416, 6602, 7019, 7415, 7623, 8112, 8485, 8724, 8994, 9445, 9667},
-      {30, 27, 174, 188, 631, 1172, 1427, 1779, 2217, 2270, 2601, 2813, 3196, 3582, 3895, 3908, 3948, 4463, 4955, 5120, 5809, 5988, 6478, 6604, 7096, 7673, 7735, 7795, 8925, 9613, 9670},
-      {30, 27, 370, 617, 852, 910, 1030, 1326, 1521, 1606, 2118, 2248, 2909, 3214, 3413, 3623, 3742, 3752, 4317, 4694, 5300, 5687, 6039, 6100, 6232, 6491, 6621, 6860, 7304, 8542, 8634},
-      {4, 990, 1753, 7635, 8540, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 933, 1415, 5666, 8745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 27, 6567, 8707, 9216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2341, 8692, 9580, 9615, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 260, 1092, 5839, 6080, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 352, 3750, 4847, 7726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4610, 6580, 9506, 9597, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2512, 2974, 4814, 9348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1461, 4021, 5060, 7009, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1796, 2883, 5553, 8306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1249, 5422, 7057, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3965, 6968, 9422, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1498, 2931, 5092, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 27, 1090, 6215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 26, 4232, 6354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_7_15S[21][25] = {
-    {24, 553, 742, 901, 1327, 1544, 2179, 2519, 3131, 3280, 3603, 3789, 3792, 4253, 5340, 5934, 5962, 6004, 6698, 7793, 8001, 8058, 8126, 8276, 8559},
-      {24, 503, 590, 598, 1185, 1266, 1336, 1806, 2473, 3021, 3356, 3490, 3680, 3936, 4501, 4659, 5891, 6132, 6340, 6602, 7447, 8007, 8045, 8059, 8249},
-      {24, 795, 831, 947, 1330, 1502, 2041, 2328, 2513, 2814, 2829, 4048, 4802, 6044, 6109, 6461, 6777, 6800, 7099, 7126, 8095, 8428, 8519, 8556, 8610},
-      {24, 601, 787, 899, 1757, 2259, 2518, 2783, 2816, 2823, 2949, 3396, 4330, 4494, 4684, 4700, 4837, 4881, 4975, 5130, 5464, 6554, 6912, 7094, 8297},
-      {4, 4229, 5628, 7917, 7992, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1506, 3374, 4174, 5547, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 4275, 5650, 8208, 8533, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1504, 1747, 3433, 6345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 3659, 6955, 7575, 7852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 607, 3002, 4913, 6453, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 3533, 6860, 7895, 8048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4094, 6366, 8314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2206, 4513, 5411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 32, 3882, 5149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 389, 3121, 4626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1308, 4419, 6520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2092, 2373, 6849, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1815, 3679, 7152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3582, 3979, 6948, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1049, 2135, 3754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2276, 4442, 6591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_8_15S[24][33] = {
-      {32, 5, 519, 825, 1871, 2098, 2478, 2659, 2820, 3200, 3294, 3650, 3804, 3949, 4426, 4460, 4503, 4568, 4590, 4949, 5219, 5662, 5738, 5905, 5911, 6160, 6404, 6637, 6708, 6737, 6814, 7263, 7412},
-      {32, 81, 391, 1272, 1633, 2062, 2882, 3443, 3503, 3535, 3908, 4033, 4163, 4490, 4929, 5262, 5399, 5576, 5768, 5910, 6331, 6430, 6844, 6867, 7201, 7274, 7290, 7343, 7350, 7378, 7387, 7440, 7554},
-      {14, 105, 975, 3421, 3480, 4120, 4444, 5957, 5971, 6119, 6617, 6761, 6810, 7067, 7353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {14, 6, 138, 485, 1444, 1512, 2615, 2990, 3109, 5604, 6435, 6513, 6632, 6704, 7507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {14, 20, 858, 1051, 2539, 3049, 5162, 5308, 6158, 6391, 6604, 6744, 7071, 7195, 7238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1140, 5838, 6203, 6748, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6282, 6466, 6481, 6638, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2346, 2592, 5436, 7487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 2219, 3897, 5896, 7528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2897, 6028, 7018, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1285, 1863, 5324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3075, 6005, 6466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5, 6020, 7551, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2121, 3751, 7507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4027, 5488, 7542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2, 6012, 7011, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3823, 5531, 5687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1379, 2262, 5297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1882, 7498, 7551, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3749, 4806, 7227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2, 2074, 6898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 17, 616, 7482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9, 6823, 7480, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5195, 5880, 7559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_9_15S[27][17] = {
-      {16, 212, 255, 540, 967, 1033, 1517, 1538, 3124, 3408, 3800, 4373, 4864, 4905, 5163, 5177, 6186},
-      {16, 275, 660, 1351, 2211, 2876, 3063, 3433, 4088, 4273, 4544, 4618, 4632, 5548, 6101, 6111, 6136},
-      {16, 279, 335, 494, 865, 1662, 1681, 3414, 3775, 4252, 4595, 5272, 5471, 5796, 5907, 5986, 6008},
-      {10, 345, 352, 3094, 3188, 4297, 4338, 4490, 4865, 5303, 6477, 0, 0, 0, 0, 0, 0},
-      {10, 222, 681, 1218, 3169, 3850, 4878, 4954, 5666, 6001, 6237, 0, 0, 0, 0, 0, 0},
-      {9, 172, 512, 1536, 1559, 2179, 2227, 3334, 4049, 6464, 0, 0, 0, 0, 0, 0, 0},
-      {9, 716, 934, 1694, 2890, 3276, 3608, 4332, 4468, 5945, 0, 0, 0, 0, 0, 0, 0},
-      {9, 1133, 1593, 1825, 2571, 3017, 4251, 5221, 5639, 5845, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1076, 1222, 6465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 159, 5064, 6078, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 374, 4073, 5357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2833, 5526, 5845, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1594, 3639, 5419, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1028, 1392, 4239, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 115, 622, 2175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 300, 1748, 6245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2724, 3276, 5349, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1433, 6117, 6448, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 485, 663, 4955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 711, 1132, 4315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 177, 3266, 4339, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1171, 4841, 4982, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 33, 1584, 3692, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2820, 3485, 4249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1716, 2428, 3125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 250, 2275, 6338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 108, 1719, 4961, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_10_15S[30][26] = {
-      {25, 352, 747, 894, 1437, 1688, 1807, 1883, 2119, 2159, 3321, 3400, 3543, 3588, 3770, 3821, 4384, 4470, 4884, 5012, 5036, 5084, 5101, 5271, 5281, 5353},
-      {25, 505, 915, 1156, 1269, 1518, 1650, 2153, 2256, 2344, 2465, 2509, 2867, 2875, 3007, 3254, 3519, 3687, 4331, 4439, 4532, 4940, 5011, 5076, 5113, 5367},
-      {14, 268, 346, 650, 919, 1260, 4389, 4653, 4721, 4838, 5054, 5157, 5162, 5275, 5362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {14, 220, 236, 828, 1590, 1792, 3259, 3647, 4276, 4281, 4325, 4963, 4974, 5003, 5037, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {14, 381, 737, 1099, 1409, 2364, 2955, 3228, 3341, 3473, 3985, 4257, 4730, 5173, 5242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {14, 88, 771, 1640, 1737, 1803, 2408, 2575, 2974, 3167, 3464, 3780, 4501, 4901, 5047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 749, 1502, 2201, 3189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2873, 3245, 3427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2158, 2605, 3165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1, 3438, 3606, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 10, 3019, 5221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 371, 2901, 2923, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 9, 3935, 4683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1937, 3502, 3735, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 507, 3128, 4994, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 25, 3854, 4550, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1178, 4737, 5366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2, 223, 5304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1146, 5175, 5197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1816, 2313, 3649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 740, 1951, 3844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1320, 3703, 4791, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1754, 2905, 4058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 7, 917, 5277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3048, 3954, 5396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 4804, 4824, 5105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2812, 3895, 5226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 0, 5318, 5358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1483, 2324, 4826, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2266, 4752, 5387, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_11_15S[33][13] = {
-      {12, 49, 719, 784, 794, 968, 2382, 2685, 2873, 2974, 2995, 3540, 4179},
-      {12, 272, 281, 374, 1279, 2034, 2067, 2112, 3429, 3613, 3815, 3838, 4216},
-      {12, 206, 714, 820, 1800, 1925, 2147, 2168, 2769, 2806, 3253, 3415, 4311},
-      {12, 62, 159, 166, 605, 1496, 1711, 2652, 3016, 3347, 3517, 3654, 4113},
-      {12, 363, 733, 1118, 2062, 2613, 2736, 3143, 3427, 3664, 4100, 4157, 4314},
-      {12, 57, 142, 436, 983, 1364, 2105, 2113, 3074, 3639, 3835, 4164, 4242},
-      {12, 870, 921, 950, 1212, 1861, 2128, 2707, 2993, 3730, 3968, 3983, 4227},
-      {3, 185, 2684, 3263, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2035, 2123, 2913, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 883, 2221, 3521, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1344, 1773, 4132, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 438, 3178, 3650, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 543, 756, 1639, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1057, 2337, 2898, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 171, 3298, 3929, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1626, 2960, 3503, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 484, 3050, 3323, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2283, 2336, 4189, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2732, 4132, 4318, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 225, 2335, 3497, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 600, 2246, 2658, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1240, 2790, 3020, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 301, 1097, 3539, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1222, 1267, 2594, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1364, 2004, 3603, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1142, 1185, 2147, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 564, 1505, 2086, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 697, 991, 2908, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1467, 2073, 3462, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2574, 2818, 3637, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 748, 2577, 2772, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1151, 1419, 4129, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 164, 1238, 3401, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_12_15S[36][15] = {
-      {14, 3, 394, 1014, 1214, 1361, 1477, 1534, 1660, 1856, 2745, 2987, 2991, 3124, 3155},
-      {14, 59, 136, 528, 781, 803, 928, 1293, 1489, 1944, 2041, 2200, 2613, 2690, 2847},
-      {14, 155, 245, 311, 621, 1114, 1269, 1281, 1783, 1995, 2047, 2672, 2803, 2885, 3014},
-      {14, 79, 870, 974, 1326, 1449, 1531, 2077, 2317, 2467, 2627, 2811, 3083, 3101, 3132},
-      {14, 4, 582, 660, 902, 1048, 1482, 1697, 1744, 1928, 2628, 2699, 2728, 3045, 3104},
-      {14, 175, 395, 429, 1027, 1061, 1068, 1154, 1168, 1175, 2147, 2359, 2376, 2613, 2682},
-      {4, 1388, 2241, 3118, 3148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 143, 506, 2067, 3148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1594, 2217, 2705, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 398, 988, 2551, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1149, 2588, 2654, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 678, 2844, 3115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1508, 1547, 1954, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1199, 1267, 1710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2589, 3163, 3207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1, 2583, 2974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2766, 2897, 3166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 929, 1823, 2742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1113, 3007, 3239, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1753, 2478, 3127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 0, 509, 1811, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1672, 2646, 2984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 965, 1462, 3230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3, 1077, 2917, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1183, 1316, 1662, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 968, 1593, 3239, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 64, 1996, 2226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1442, 2058, 3181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 513, 973, 1058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1263, 3185, 3229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 681, 1394, 3017, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 419, 2853, 3217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 3, 2404, 3175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 2417, 2792, 2854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 1879, 2940, 3235, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 647, 1704, 3060, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    const uint16_t ldpc_bb_impl::ldpc_tab_13_15S[39][14] = {
-      {13, 71, 334, 645, 779, 786, 1124, 1131, 1267, 1379, 1554, 1766, 1798, 1939},
-      {13, 6, 183, 364, 506, 512, 922, 972, 981, 1039, 1121, 1537, 1840, 2111},
-      {13, 6, 71, 153, 204, 253, 268, 781, 799, 873, 1118, 1194, 1661, 2036},
-      {13, 6, 247, 353, 581, 921, 940, 1108, 1146, 1208, 1268, 1511, 1527, 1671},
-      {13, 6, 37, 466, 548, 747, 1142, 1203, 1271, 1512, 1516, 1837, 1904, 2125},
-      {13, 6, 171, 863, 953, 1025, 1244, 1378, 1396, 1723, 1783, 1816, 1914, 2121},
-      {4, 1268, 1360, 1647, 1769, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6, 458, 1231, 1414, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 183, 535, 1244, 1277, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 107, 360, 498, 1456, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6, 2007, 2059, 2120, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 1480, 1523, 1670, 1927, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 139, 573, 711, 1790, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6, 1541, 1889, 2023, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 6, 374, 957, 1174, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {4, 287, 423, 872, 1285, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 6, 1809, 1918, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 65, 818, 1396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 590, 766, 2107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 192, 814, 1843, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 775, 1163, 1256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 42, 735, 1415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 334, 1008, 2055, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 109, 596, 1785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 406, 534, 1852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 684, 719, 1543, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 401, 465, 1040, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 112, 392, 621, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 82, 897, 1950, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 887, 1962, 2125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 793, 1088, 2159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 723, 919, 1139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 610, 839, 1302, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 218, 1080, 1816, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 627, 1646, 1749, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 496, 1165, 1741, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 916, 1055, 1662, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 182, 722, 945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-      {3, 5, 595, 1674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
   } /* namespace atsc3 */
 } /* namespace gr */
@@ -0,0 +1,57 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <map>
+#include <mutex>
+#include <utility>
+#include "ldpc_cache.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    typedef std::pair<atsc3_framesize_t, atsc3_code_rate_t> ldpc_cache_key_t;
+
+/*
+ * Entries hold weak references, so the tables are freed with their
+ * last user. They are built under the lock, a second block asking
+ * for the same code waits instead of building a duplicate.
+ */
+
+    template <typename T>
+    static std::shared_ptr<const T>
+    ldpc_cache_get(std::map<ldpc_cache_key_t, std::weak_ptr<const T>>& cache, std::mutex& lock, atsc3_framesize_t framesize, atsc3_code_rate_t rate)
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      std::weak_ptr<const T>& entry = cache[ldpc_cache_key_t(framesize, rate)];
+      std::shared_ptr<const T> tables = entry.lock();
+      if (!tables) {
+        tables = std::make_shared<const T>(framesize, rate);
+        entry = tables;
+      }
+      return tables;
+    }
+
+    std::shared_ptr<const ldpc_lut>
+    ldpc_cache_lut(atsc3_framesize_t framesize, atsc3_code_rate_t rate)
+    {
+      static std::mutex lock;
+      static std::map<ldpc_cache_key_t, std::weak_ptr<const ldpc_lut>> cache;
+
+      return ldpc_cache_get(cache, lock, framesize, rate);
+    }
+
+    std::shared_ptr<const ldpc_packed>
+    ldpc_cache_packed(atsc3_framesize_t framesize, atsc3_code_rate_t rate)
+    {
+      static std::mutex lock;
+      static std::map<ldpc_cache_key_t, std::weak_ptr<const ldpc_packed>> cache;
+
+      return ldpc_cache_get(cache, lock, framesize, rate);
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
@@ -0,0 +1,31 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_LDPC_CACHE_H
+#define INCLUDED_ATSC3_LDPC_CACHE_H
+
+#include <memory>
+#include <atsc3/atsc3_config.h>
+#include "ldpc_lut.h"
+#include "ldpc_packed.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Process wide cache of the LDPC encoder tables. The first block
+     * that needs a code builds the tables, later blocks (and the frame
+     * mapper L1 encoders) share the same read-only instance. Entries
+     * are released when the last block using them is destroyed.
+     */
+    std::shared_ptr<const ldpc_lut> ldpc_cache_lut(atsc3_framesize_t framesize, atsc3_code_rate_t rate);
+    std::shared_ptr<const ldpc_packed> ldpc_cache_packed(atsc3_framesize_t framesize, atsc3_code_rate_t rate);
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_LDPC_CACHE_H */
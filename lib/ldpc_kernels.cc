@@ -0,0 +1,248 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "ldpc_kernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LDPC_KERNELS_X86
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LDPC_KERNELS_NEON
+#endif
+
+namespace gr {
+  namespace atsc3 {
+
+    void
+    ldpc_kernels::parity_csr(const uint32_t* offset, const uint16_t* entry, int rows, const unsigned char* d, unsigned char* p)
+    {
+      const uint16_t* e = &entry[offset[0]];
+      for (int r = 0; r < rows; r++) {
+        const uint16_t* end = entry + offset[r + 1];
+        unsigned char pbit = 0;
+        while (e < end) {
+          pbit ^= d[*e++];
+        }
+        p[r] = pbit;
+      }
+    }
+
+    static void
+    prefix_generic(unsigned char* p, int len)
+    {
+      for (int j = 1; j < len; j++) {
+        p[j] ^= p[j - 1];
+      }
+    }
+
+#ifdef LDPC_KERNELS_X86
+/*
+ * The gathers load 32 bits at d + index, only the low byte is used.
+ * Padding lanes (index -1) are masked off.
+ */
+
+    __attribute__((target("avx2"))) static void
+    parity_avx2(const int32_t* gather, int rows, const unsigned char* d, unsigned char* p)
+    {
+      const __m256i zero = _mm256_setzero_si256();
+      const __m256i pad = _mm256_set1_epi32(-1);
+      const __m256i low = _mm256_set1_epi32(0xff);
+      const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+      const int* base = (const int*)d;
+      unsigned char tail[32];
+
+      for (int r = 0; r < rows; r += 32) {
+        const int depth = *gather++;
+        __m256i a0 = zero, a1 = zero, a2 = zero, a3 = zero;
+        for (int j = 0; j < depth; j++) {
+          const __m256i i0 = _mm256_loadu_si256((const __m256i*)&gather[0]);
+          const __m256i i1 = _mm256_loadu_si256((const __m256i*)&gather[8]);
+          const __m256i i2 = _mm256_loadu_si256((const __m256i*)&gather[16]);
+          const __m256i i3 = _mm256_loadu_si256((const __m256i*)&gather[24]);
+          a0 = _mm256_xor_si256(a0, _mm256_mask_i32gather_epi32(zero, base, i0, _mm256_cmpgt_epi32(i0, pad), 1));
+          a1 = _mm256_xor_si256(a1, _mm256_mask_i32gather_epi32(zero, base, i1, _mm256_cmpgt_epi32(i1, pad), 1));
+          a2 = _mm256_xor_si256(a2, _mm256_mask_i32gather_epi32(zero, base, i2, _mm256_cmpgt_epi32(i2, pad), 1));
+          a3 = _mm256_xor_si256(a3, _mm256_mask_i32gather_epi32(zero, base, i3, _mm256_cmpgt_epi32(i3, pad), 1));
+          gather += 32;
+        }
+        const __m256i a01 = _mm256_packus_epi32(_mm256_and_si256(a0, low), _mm256_and_si256(a1, low));
+        const __m256i a23 = _mm256_packus_epi32(_mm256_and_si256(a2, low), _mm256_and_si256(a3, low));
+        const __m256i bits = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(a01, a23), order);
+        if (rows - r >= 32) {
+          _mm256_storeu_si256((__m256i*)&p[r], bits);
+        }
+        else {
+          _mm256_storeu_si256((__m256i*)tail, bits);
+          memcpy(&p[r], tail, rows - r);
+        }
+      }
+    }
+
+    static inline __mmask16
+    store_mask(int lanes)
+    {
+      return lanes >= 16 ? 0xffff : lanes <= 0 ? 0 : (1 << lanes) - 1;
+    }
+
+    __attribute__((target("avx512f"))) static void
+    parity_avx512(const int32_t* gather, int rows, const unsigned char* d, unsigned char* p)
+    {
+      const __m512i zero = _mm512_setzero_si512();
+      const __m512i low = _mm512_set1_epi32(0xff);
+
+      for (int r = 0; r < rows; r += 64) {
+        const int depth = *gather++;
+        __m512i a0 = zero, a1 = zero, a2 = zero, a3 = zero;
+        for (int j = 0; j < depth; j++) {
+          const __m512i i0 = _mm512_loadu_si512(&gather[0]);
+          const __m512i i1 = _mm512_loadu_si512(&gather[16]);
+          const __m512i i2 = _mm512_loadu_si512(&gather[32]);
+          const __m512i i3 = _mm512_loadu_si512(&gather[48]);
+          a0 = _mm512_xor_si512(a0, _mm512_mask_i32gather_epi32(zero, _mm512_cmpge_epi32_mask(i0, zero), i0, d, 1));
+          a1 = _mm512_xor_si512(a1, _mm512_mask_i32gather_epi32(zero, _mm512_cmpge_epi32_mask(i1, zero), i1, d, 1));
+          a2 = _mm512_xor_si512(a2, _mm512_mask_i32gather_epi32(zero, _mm512_cmpge_epi32_mask(i2, zero), i2, d, 1));
+          a3 = _mm512_xor_si512(a3, _mm512_mask_i32gather_epi32(zero, _mm512_cmpge_epi32_mask(i3, zero), i3, d, 1));
+          gather += 64;
+        }
+        const int lanes = rows - r;
+        _mm512_mask_cvtepi32_storeu_epi8(&p[r], store_mask(lanes), _mm512_and_si512(a0, low));
+        _mm512_mask_cvtepi32_storeu_epi8(&p[r + 16], store_mask(lanes - 16), _mm512_and_si512(a1, low));
+        _mm512_mask_cvtepi32_storeu_epi8(&p[r + 32], store_mask(lanes - 32), _mm512_and_si512(a2, low));
+        _mm512_mask_cvtepi32_storeu_epi8(&p[r + 48], store_mask(lanes - 48), _mm512_and_si512(a3, low));
+      }
+    }
+
+/*
+ * Log-step prefix XOR within 16 bytes, then XOR with the running
+ * parity (last byte of the previous vector broadcast to all lanes).
+ */
+
+    __attribute__((target("sse2"))) static void
+    prefix_sse2(unsigned char* p, int len)
+    {
+      __m128i carry = _mm_setzero_si128();
+      int i = 0;
+
+      for (; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)&p[i]);
+        x = _mm_xor_si128(x, _mm_slli_si128(x, 1));
+        x = _mm_xor_si128(x, _mm_slli_si128(x, 2));
+        x = _mm_xor_si128(x, _mm_slli_si128(x, 4));
+        x = _mm_xor_si128(x, _mm_slli_si128(x, 8));
+        x = _mm_xor_si128(x, carry);
+        _mm_storeu_si128((__m128i*)&p[i], x);
+        carry = _mm_srli_si128(x, 15);
+        carry = _mm_unpacklo_epi8(carry, carry);
+        carry = _mm_unpacklo_epi16(carry, carry);
+        carry = _mm_shuffle_epi32(carry, 0);
+      }
+      if (i == 0) {
+        i = 1;
+      }
+      for (; i < len; i++) {
+        p[i] ^= p[i - 1];
+      }
+    }
+#endif
+
+#ifdef LDPC_KERNELS_NEON
+    static void
+    prefix_neon(unsigned char* p, int len)
+    {
+      const uint8x16_t zero = vdupq_n_u8(0);
+      uint8x16_t carry = zero;
+      int i = 0;
+
+      for (; i + 16 <= len; i += 16) {
+        uint8x16_t x = vld1q_u8(&p[i]);
+        x = veorq_u8(x, vextq_u8(zero, x, 15));
+        x = veorq_u8(x, vextq_u8(zero, x, 14));
+        x = veorq_u8(x, vextq_u8(zero, x, 12));
+        x = veorq_u8(x, vextq_u8(zero, x, 8));
+        x = veorq_u8(x, carry);
+        vst1q_u8(&p[i], x);
+        carry = vdupq_n_u8(vgetq_lane_u8(x, 15));
+      }
+      if (i == 0) {
+        i = 1;
+      }
+      for (; i < len; i++) {
+        p[i] ^= p[i - 1];
+      }
+    }
+#endif
+
+    ldpc_kernels::ldpc_kernels()
+      : width(1),
+        parity_rows(0),
+        row_offset(nullptr),
+        row_entry(nullptr),
+        parity_kernel(nullptr),
+        prefix_kernel(prefix_generic)
+    {
+      std::string parity_name = "generic";
+      std::string prefix_name = "generic";
+
+#ifdef LDPC_KERNELS_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f")) {
+        width = 64;
+        parity_kernel = parity_avx512;
+        parity_name = "avx512";
+      }
+      else if (__builtin_cpu_supports("avx2")) {
+        width = 32;
+        parity_kernel = parity_avx2;
+        parity_name = "avx2";
+      }
+      if (__builtin_cpu_supports("sse2")) {
+        prefix_kernel = prefix_sse2;
+        prefix_name = "sse2";
+      }
+#endif
+#ifdef LDPC_KERNELS_NEON
+      prefix_kernel = prefix_neon;
+      prefix_name = "neon";
+#endif
+      kernel_name = "parity " + parity_name + ", prefix " + prefix_name;
+    }
+
+    void
+    ldpc_kernels::init(const uint32_t* offset, const uint16_t* entry, int rows)
+    {
+      row_offset = offset;
+      row_entry = entry;
+      parity_rows = rows;
+      gather.clear();
+      if (!parity_kernel) {
+        return;
+      }
+      for (int r = 0; r < rows; r += width) {
+        const int lanes = std::min(width, rows - r);
+        int depth = 0;
+        for (int w = 0; w < lanes; w++) {
+          depth = std::max(depth, (int)(offset[r + w + 1] - offset[r + w]));
+        }
+        gather.push_back(depth);
+        for (int j = 0; j < depth; j++) {
+          for (int w = 0; w < width; w++) {
+            if (w < lanes && j < (int)(offset[r + w + 1] - offset[r + w])) {
+              gather.push_back(entry[offset[r + w] + j]);
+            }
+            else {
+              gather.push_back(-1);
+            }
+          }
+        }
+      }
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
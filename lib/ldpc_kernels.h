@@ -0,0 +1,78 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_LDPC_KERNELS_H
+#define INCLUDED_ATSC3_LDPC_KERNELS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Runtime dispatched parity kernels for the unpacked LDPC encoder.
+     *
+     * The parity kernel XORs the information bits of a block of parity
+     * rows at once. The gather table is lane-major: for each block
+     * the depth (largest row weight in the block) followed by depth
+     * groups of one information bit index per row, -1 for padding.
+     * The generic kernel walks the compressed rows directly.
+     *
+     * The prefix kernel replaces the serial accumulator p[j] ^= p[j - 1].
+     */
+    class ldpc_kernels
+    {
+     public:
+      ldpc_kernels();
+
+      /*
+       * Compressed rows as in ldpc_lut, the information bits of row r
+       * are entry[offset[r]] to entry[offset[r + 1] - 1]. The arrays
+       * must outlive the kernels.
+       */
+      void init(const uint32_t* offset, const uint16_t* entry, int rows);
+
+      /* d may be over-read by 3 bytes past the largest information bit index. */
+      void parity(const unsigned char* d, unsigned char* p) const
+      {
+        if (parity_kernel) {
+          parity_kernel(gather.data(), parity_rows, d, p);
+        }
+        else {
+          parity_csr(row_offset, row_entry, parity_rows, d, p);
+        }
+      }
+
+      void prefix_xor(unsigned char* p, int len) const
+      {
+        prefix_kernel(p, len);
+      }
+
+      const std::string& name() const { return kernel_name; }
+
+     private:
+      typedef void (*parity_kernel_t)(const int32_t* gather, int rows, const unsigned char* d, unsigned char* p);
+      typedef void (*prefix_kernel_t)(unsigned char* p, int len);
+
+      static void parity_csr(const uint32_t* offset, const uint16_t* entry, int rows, const unsigned char* d, unsigned char* p);
+
+      std::string kernel_name;
+      int width;
+      int parity_rows;
+      std::vector<int32_t> gather;
+      const uint32_t* row_offset;
+      const uint16_t* row_entry;
+      parity_kernel_t parity_kernel;
+      prefix_kernel_t prefix_kernel;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_LDPC_KERNELS_H */
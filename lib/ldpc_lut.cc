@@ -0,0 +1,116 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "ldpc_lut.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    ldpc_lut::ldpc_lut(atsc3_framesize_t framesize, atsc3_code_rate_t rate)
+    {
+      if (framesize == FECFRAME_NORMAL) {
+        frame_size = FRAME_SIZE_NORMAL;
+      }
+      else {
+        frame_size = FRAME_SIZE_SHORT;
+      }
+      struct fec_params_t p = fec_params(framesize, rate);
+      nbch = p.nbch;
+      ldpc_type = p.ldpc_type;
+      if (ldpc_type == LDPC_TYPE_A) {
+        q1 = p.q1_val;
+        q2 = p.q2_val;
+      }
+      else {
+        q1 = p.q_val;
+        q2 = 0;
+      }
+      m1 = 360 * q1;
+      ldpc_expand(ldpc_table(framesize, rate));
+      kernels.init(row_offset.data(), row_entry.data(), frame_size - nbch);
+    }
+
+/*
+ * fill the compressed rows in natural parity order, every parity bit
+ * of a column class has the same number of information bits, the
+ * addresses are rotated by the position of the bit in the class
+ */
+
+    void
+    ldpc_lut::ldpc_expand(const ldpc_table_t& table)
+    {
+      const int pbits = frame_size - nbch;
+
+      row_offset.assign(1, 0);
+      row_entry.clear();
+      expand_rows(table, 0, pbits, 0, row_offset, row_entry);
+      aux_offset.assign(1, 0);
+      aux_entry.clear();
+      if (ldpc_type == LDPC_TYPE_A) {
+        /* the last q2 classes address the part 1 parity */
+        expand_rows(table, m1, pbits, q2, aux_offset, aux_entry);
+      }
+    }
+
+    void
+    ldpc_lut::expand_rows(const ldpc_table_t& table, int first, int last, int aux, std::vector<uint32_t>& offset, std::vector<uint16_t>& entry)
+    {
+      for (int i_p = first; i_p < last; i_p++) {
+        int c, r;
+        if (i_p < m1) {
+          c = i_p % q1;
+          r = i_p / q1;
+        }
+        else {
+          c = q1 + ((i_p - m1) % q2) + aux;
+          r = (i_p - m1) / q2;
+        }
+        for (int e = table.offset[c]; e < table.offset[c + 1]; e++) {
+          const int group = table.entry[e] / 360;
+          const int start = table.entry[e] % 360;
+          entry.push_back((360 * group) + ((start + r) % 360));
+        }
+        offset.push_back(entry.size());
+      }
+    }
+
+    void
+    ldpc_lut::encode(unsigned char* frame, unsigned char* buffer) const
+    {
+      const int plen = frame_size - nbch;
+
+      if (ldpc_type == LDPC_TYPE_A) {
+        kernels.parity(frame, buffer);
+        kernels.prefix_xor(buffer, m1);
+        for (int t = 0; t < q1; t++) {
+          for (int s = 0; s < 360; s++) {
+            frame[nbch + (360 * t) + s] = buffer[(q1 * s) + t];
+          }
+        }
+        const uint16_t* e = aux_entry.data();
+        for (int i_p = m1; i_p < plen; i_p++) {
+          const uint16_t* end = aux_entry.data() + aux_offset[i_p - m1 + 1];
+          unsigned char pbit = 0;
+          while (e < end) {
+            pbit ^= frame[*e++];
+          }
+          buffer[i_p] ^= pbit;
+        }
+        for (int t = 0; t < q2; t++) {
+          for (int s = 0; s < 360; s++) {
+            frame[nbch + m1 + (360 * t) + s] = buffer[(m1 + q2 * s) + t];
+          }
+        }
+      }
+      else {
+        kernels.parity(frame, &frame[nbch]);
+        kernels.prefix_xor(&frame[nbch], plen);
+      }
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
@@ -1,175 +1,74 @@
-      template <typename entry_t, size_t rows, size_t cols>
-      void ldpc_bf_type_b(entry_t (&table)[rows][cols])
-      {
-        uint16_t max_lut_arraysize = 0;
-        const unsigned int pbits = FRAME_SIZE_SHORT - NBCH_6_15;
-        const unsigned int q = q_val;
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
 
-        for (auto& ldpc_lut_index_entry : ldpc_lut_index) {
-          ldpc_lut_index_entry = 1; /* 1 for the size at the start of the array */
-        }
+#ifndef INCLUDED_ATSC3_LDPC_LUT_H
+#define INCLUDED_ATSC3_LDPC_LUT_H
 
-        for (unsigned int row = 0; row < rows; row++) {
-          for (unsigned int n = 0; n < 360; n++) {
-            for (unsigned int col = 1; col <= table[row][0]; col++) {
-              unsigned int current_pbit = (table[row][col] + (n * q)) % pbits;
-              ldpc_lut_index[current_pbit]++;
-              if (ldpc_lut_index[current_pbit] > max_lut_arraysize) {
-                max_lut_arraysize = ldpc_lut_index[current_pbit];
-              }
-            }
-          }
-        }
-        if (max_lut_arraysize & 0x1) { /* Optimize for RISC-V */
-          max_lut_arraysize++;
-        }
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ldpc_kernels.h"
+#include "ldpc_tables.h"
+#include "params.h"
 
-        /* Allocate a 2D Array with pbits * max_lut_arraysize
-         * while preserving two-subscript access
-         * see
-         * https://stackoverflow.com/questions/29375797/copy-2d-array-using-memcpy/29375830#29375830
-         */
-        ldpc_lut_b.resize(pbits);
-        ldpc_lut_b_data.resize(pbits * max_lut_arraysize);
-        ldpc_lut_b_data[0] = 1;
-        ldpc_lut_b[0] = ldpc_lut_b_data.data();
-        for (unsigned int i = 1; i < pbits; i++) {
-          ldpc_lut_b[i] = ldpc_lut_b[i - 1] + max_lut_arraysize;
-          ldpc_lut_b[i][0] = 1;
-        }
-        uint16_t im = 0;
-        for (unsigned int row = 0; row < rows; row++) {
-          for (unsigned int n = 0; n < 360; n++) {
-            for (unsigned int col = 1; col <= table[row][0]; col++) {
-              unsigned int current_pbit = (table[row][col] + (n * q)) % pbits;
-              ldpc_lut_b[current_pbit][ldpc_lut_b[current_pbit][0]] = im;
-              ldpc_lut_b[current_pbit][0]++;
-            }
-            im++;
-          }
-        }
-      }
+namespace gr {
+  namespace atsc3 {
 
-      template <typename entry_t, size_t rows, size_t cols>
-      void ldpc_bf_type_a(entry_t (&table)[rows][cols])
-      {
-        int im = 0;
-        int row;
-        uint16_t max_lut_arraysize = 0;
-        const unsigned int pbits = FRAME_SIZE_SHORT - NBCH_3_15;
+    /*
+     * Unpacked LDPC encoder, one byte per bit.
+     *
+     * The parity check matrix is kept in compressed rows: the
+     * information bits of parity bit r are row_entry[row_offset[r]]
+     * to row_entry[row_offset[r + 1] - 1]. Type A codes keep the part 1
+     * parity contributions to part 2 in aux_offset/aux_entry, one row
+     * per part 2 parity bit. The rows are expanded from the compiled
+     * quasi-cyclic tables in ldpc_tables.cc, they are read-only after
+     * construction and are shared between blocks through ldpc_cache.
+     */
+    class ldpc_lut
+    {
+     public:
+      ldpc_lut(atsc3_framesize_t framesize, atsc3_code_rate_t rate);
 
-        for (auto& ldpc_lut_index_entry : ldpc_lut_index) {
-          ldpc_lut_index_entry = 1; /* 1 for the size at the start of the array */
-        }
+      // Disallow copy/move because the kernels point into the rows.
+      ldpc_lut(const ldpc_lut&) = delete;
+      ldpc_lut(ldpc_lut&&) = delete;
+      ldpc_lut& operator=(const ldpc_lut&) = delete;
+      ldpc_lut& operator=(ldpc_lut&&) = delete;
 
-        for (unsigned int row = 0; row < rows; row++) {
-          if (im == NBCH_3_15) {
-            break;
-          }
-          for (unsigned int n = 0; n < 360; n++) {
-            for (unsigned int col = 1; col <= table[row][0]; col++) {
-              if ((im % 360) == 0) {
-                unsigned int current_pbit = table[row][col];
-                ldpc_lut_index[current_pbit]++;
-                if (ldpc_lut_index[current_pbit] > max_lut_arraysize) {
-                  max_lut_arraysize = ldpc_lut_index[current_pbit];
-                }
-              }
-              else {
-                if (table[row][col] < m1_val) {
-                  unsigned int current_pbit = (table[row][col] + (n * q1_val)) % m1_val;
-                  ldpc_lut_index[current_pbit]++;
-                  if (ldpc_lut_index[current_pbit] > max_lut_arraysize) {
-                    max_lut_arraysize = ldpc_lut_index[current_pbit];
-                  }
-                }
-                else {
-                  unsigned int current_pbit = m1_val + (table[row][col] - m1_val + (n * q2_val)) % m2_val;
-                  ldpc_lut_index[current_pbit]++;
-                  if (ldpc_lut_index[current_pbit] > max_lut_arraysize) {
-                    max_lut_arraysize = ldpc_lut_index[current_pbit];
-                  }
-                }
-              }
-            }
-            im++;
-          }
-        }
-        im = 0;
-        if (max_lut_arraysize & 0x1) { /* Optimize for RISC-V */
-          max_lut_arraysize++;
-        }
+      /*
+       * frame holds the nbch information bits, the parity bits are
+       * appended. Type A parity is written in the A/322 output order
+       * (part 1 and part 2 column-wise), type B parity in natural order.
+       * buffer is frame_size - nbch bytes of scratch for type A codes.
+       * frame may be over-read by 3 bytes past the information bits.
+       */
+      void encode(unsigned char* frame, unsigned char* buffer) const;
 
-        /* Allocate a 2D Array with pbits * max_lut_arraysize
-         * while preserving two-subscript access
-         * see
-         * https://stackoverflow.com/questions/29375797/copy-2d-array-using-memcpy/29375830#29375830
-         */
-        ldpc_lut_a.resize(pbits);
-        ldpc_lut_a_data.resize(pbits * max_lut_arraysize);
-        ldpc_lut_a_data[0] = 1;
-        ldpc_lut_a[0] = ldpc_lut_a_data.data();
-        for (unsigned int i = 1; i < pbits; i++) {
-          ldpc_lut_a[i] = ldpc_lut_a[i - 1] + max_lut_arraysize;
-          ldpc_lut_a[i][0] = 1;
-        }
-        ldpc_lut_a_aux.resize(pbits);
-        ldpc_lut_a_aux_data.resize(pbits * max_lut_arraysize);
-        ldpc_lut_a_aux_data[0] = 1;
-        ldpc_lut_a_aux[0] = ldpc_lut_a_aux_data.data();
-        for (unsigned int i = 1; i < pbits; i++) {
-          ldpc_lut_a_aux[i] = ldpc_lut_a_aux[i - 1] + max_lut_arraysize;
-          ldpc_lut_a_aux[i][0] = 1;
-        }
-        for (row = 0; row < (int)rows; row++) {
-          if (im == NBCH_3_15) {
-            break;
-          }
-          for (int n = 0; n < 360; n++) {
-            for (int col = 1; col <= table[row][0]; col++) {
-              if ((im % 360) == 0) {
-                unsigned int current_pbit = table[row][col];
-                ldpc_lut_a[current_pbit][ldpc_lut_a[current_pbit][0]] = im;
-                ldpc_lut_a[current_pbit][0]++;
-              }
-              else {
-                if (table[row][col] < m1_val) {
-                  unsigned int current_pbit = (table[row][col] + (n * q1_val)) % m1_val;
-                  ldpc_lut_a[current_pbit][ldpc_lut_a[current_pbit][0]] = im;
-                  ldpc_lut_a[current_pbit][0]++;
-                }
-                else {
-                  unsigned int current_pbit = m1_val + (table[row][col] - m1_val + (n * q2_val)) % m2_val;
-                  ldpc_lut_a[current_pbit][ldpc_lut_a[current_pbit][0]] = im;
-                  ldpc_lut_a[current_pbit][0]++;
-                }
-              }
-            }
-            im++;
-          }
-        }
-        for (;row < (int)rows; row++) {
-          for (int n = 0; n < 360; n++) {
-            for (int col = 1; col <= table[row][0]; col++) {
-              if ((im % 360) == 0) {
-                unsigned int current_pbit = table[row][col];
-                ldpc_lut_a_aux[current_pbit][ldpc_lut_a_aux[current_pbit][0]] = im;
-                ldpc_lut_a_aux[current_pbit][0]++;
-              }
-              else {
-                if (table[row][col] < m1_val) {
-                  unsigned int current_pbit = (table[row][col] + (n * q1_val)) % m1_val;
-                  ldpc_lut_a_aux[current_pbit][ldpc_lut_a_aux[current_pbit][0]] = im;
-                  ldpc_lut_a_aux[current_pbit][0]++;
-                }
-                else {
-                  unsigned int current_pbit = m1_val + (table[row][col] - m1_val + (n * q2_val)) % m2_val;
-                  ldpc_lut_a_aux[current_pbit][ldpc_lut_a_aux[current_pbit][0]] = im;
-                  ldpc_lut_a_aux[current_pbit][0]++;
-                }
-              }
-            }
-            im++;
-          }
-        }
-      }
+      const std::string& kernel_name() const { return kernels.name(); }
+
+     private:
+      int frame_size;
+      int nbch;
+      int ldpc_type;
+      int q1;
+      int q2;
+      int m1;
+      std::vector<uint32_t> row_offset;
+      std::vector<uint16_t> row_entry;
+      std::vector<uint32_t> aux_offset;
+      std::vector<uint16_t> aux_entry;
+      ldpc_kernels kernels;
+
+      void ldpc_expand(const ldpc_table_t& table);
+      void expand_rows(const ldpc_table_t& table, int first, int last, int aux, std::vector<uint32_t>& offset, std::vector<uint16_t>& entry);
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_LDPC_LUT_H */
@@ -0,0 +1,212 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <cstring>
+#include "ldpc_packed.h"
+
+#define GROUP_BYTES 45   /* 360 bits */
+#define GROUP_WORDS 12   /* two copies of a group, 720 bits padded to 768 */
+#define PARITY_WORDS 6   /* 360 bits padded to 384 */
+#define PARITY_MASK 0xffffffffff000000ULL  /* valid bits of the last word */
+
+namespace gr {
+  namespace atsc3 {
+
+    ldpc_packed::ldpc_packed(atsc3_framesize_t framesize, atsc3_code_rate_t rate)
+    {
+      init(ldpc_table(framesize, rate), fec_params(framesize, rate));
+    }
+
+/*
+ * The column classes of the compiled table are the packed parity
+ * columns, the auxiliary classes are merged into part 2. A group is
+ * stored twice in a row, so a rotation starting at bit s of the group
+ * is the 360 bits starting at bit s of the doubled group.
+ */
+
+    void
+    ldpc_packed::init(const ldpc_table_t& table, const fec_params_t& p)
+    {
+      nbch = p.nbch;
+      ldpc_type = p.ldpc_type;
+      info_groups = nbch / 360;
+      if (ldpc_type == LDPC_TYPE_A) {
+        aux_groups = p.q1_val;
+        part1_columns = p.q1_val;
+        part2_columns = p.q2_val;
+      }
+      else {
+        aux_groups = 0;
+        part1_columns = p.q_val;
+        part2_columns = 0;
+      }
+      column_start.assign(1, 0);
+      column_entry.clear();
+      for (int c = 0; c < part1_columns + part2_columns; c++) {
+        add_column(table, c);
+        if (c >= part1_columns) {
+          add_column(table, c + part2_columns);
+        }
+        column_start.push_back(column_entry.size());
+      }
+      scratch_size = ((info_groups + aux_groups) * GROUP_WORDS) + ((part1_columns + part2_columns) * PARITY_WORDS);
+    }
+
+    void
+    ldpc_packed::add_column(const ldpc_table_t& table, int c)
+    {
+      for (int e = table.offset[c]; e < table.offset[c + 1]; e++) {
+        const int group = table.entry[e] / 360;
+        const int start = table.entry[e] % 360;
+        const uint32_t offset = (group * GROUP_WORDS) + (start / 64);
+        column_entry.push_back((offset << 6) | (start % 64));
+      }
+    }
+
+    void
+    ldpc_packed::load_group(const unsigned char* bytes, uint64_t* words) const
+    {
+      unsigned char doubled[GROUP_WORDS * 8];
+
+      memcpy(&doubled[0], bytes, GROUP_BYTES);
+      memcpy(&doubled[GROUP_BYTES], bytes, GROUP_BYTES);
+      memset(&doubled[GROUP_BYTES * 2], 0, sizeof(doubled) - (GROUP_BYTES * 2));
+      for (int i = 0; i < GROUP_WORDS; i++) {
+        uint64_t word = 0;
+        for (int j = 0; j < 8; j++) {
+          word = (word << 8) | doubled[(i * 8) + j];
+        }
+        words[i] = word;
+      }
+    }
+
+    void
+    ldpc_packed::parity_columns(const uint64_t* groups, uint64_t* parity, int first, int last) const
+    {
+      for (int c = first; c < last; c++) {
+        uint64_t p0 = 0, p1 = 0, p2 = 0, p3 = 0, p4 = 0, p5 = 0;
+        for (uint32_t e = column_start[c]; e < column_start[c + 1]; e++) {
+          const uint64_t* w = &groups[column_entry[e] >> 6];
+          const int s = column_entry[e] & 63;
+          /* (w[i + 1] >> 1) >> (63 - s) avoids the undefined shift by 64 when s is 0. */
+          p0 ^= (w[0] << s) | ((w[1] >> 1) >> (63 - s));
+          p1 ^= (w[1] << s) | ((w[2] >> 1) >> (63 - s));
+          p2 ^= (w[2] << s) | ((w[3] >> 1) >> (63 - s));
+          p3 ^= (w[3] << s) | ((w[4] >> 1) >> (63 - s));
+          p4 ^= (w[4] << s) | ((w[5] >> 1) >> (63 - s));
+          p5 ^= (w[5] << s) | ((w[6] >> 1) >> (63 - s));
+        }
+        uint64_t* p = &parity[c * PARITY_WORDS];
+        p[0] = p0;
+        p[1] = p1;
+        p[2] = p2;
+        p[3] = p3;
+        p[4] = p4;
+        p[5] = p5 & PARITY_MASK;
+      }
+    }
+
+/*
+ * Packed equivalent of p[j] ^= p[j - 1] over the natural parity order
+ * j = (360 bit index) * Q + column. Column c is XORed with all lower
+ * columns, then every bit is XORed with the parity of all columns
+ * at the lower bit indices (an exclusive prefix XOR of the sum).
+ */
+
+    void
+    ldpc_packed::accumulate(uint64_t* parity, int columns) const
+    {
+      uint64_t sum[PARITY_WORDS] = {0};
+      uint64_t prefix[PARITY_WORDS];
+      uint64_t carry = 0;
+
+      for (int c = 0; c < columns; c++) {
+        uint64_t* p = &parity[c * PARITY_WORDS];
+        for (int i = 0; i < PARITY_WORDS; i++) {
+          sum[i] ^= p[i];
+          p[i] = sum[i];
+        }
+      }
+      for (int i = 0; i < PARITY_WORDS; i++) {
+        uint64_t y = sum[i];
+        y ^= y >> 1;
+        y ^= y >> 2;
+        y ^= y >> 4;
+        y ^= y >> 8;
+        y ^= y >> 16;
+        y ^= y >> 32;
+        y ^= carry;
+        prefix[i] = y ^ sum[i];
+        carry = 0 - (y & 1);
+      }
+      for (int c = 0; c < columns; c++) {
+        uint64_t* p = &parity[c * PARITY_WORDS];
+        for (int i = 0; i < PARITY_WORDS; i++) {
+          p[i] ^= prefix[i];
+        }
+      }
+    }
+
+    void
+    ldpc_packed::write_columns(const uint64_t* parity, unsigned char* out, int first, int last) const
+    {
+      for (int c = first; c < last; c++) {
+        const uint64_t* p = &parity[c * PARITY_WORDS];
+        for (int b = 0; b < GROUP_BYTES; b++) {
+          *out++ = p[b / 8] >> (56 - ((b % 8) * 8));
+        }
+      }
+    }
+
+    void
+    ldpc_packed::write_transposed(const uint64_t* parity, unsigned char* out, int columns) const
+    {
+      unsigned int byte = 0;
+      int bits = 0;
+
+      for (int r = 0; r < 360; r++) {
+        const uint64_t* p = &parity[r / 64];
+        const int shift = 63 - (r % 64);
+        for (int c = 0; c < columns; c++) {
+          byte = (byte << 1) | ((p[c * PARITY_WORDS] >> shift) & 0x1);
+          if (++bits == 8) {
+            *out++ = byte;
+            byte = 0;
+            bits = 0;
+          }
+        }
+      }
+    }
+
+    void
+    ldpc_packed::encode(unsigned char* frame, uint64_t* scratch) const
+    {
+      unsigned char* p = &frame[nbch / 8];
+      uint64_t* groups = scratch;
+      uint64_t* parity = &scratch[(info_groups + aux_groups) * GROUP_WORDS];
+
+      for (int g = 0; g < info_groups; g++) {
+        load_group(&frame[g * GROUP_BYTES], &groups[g * GROUP_WORDS]);
+      }
+      parity_columns(groups, parity, 0, part1_columns);
+      if (ldpc_type == LDPC_TYPE_A) {
+        accumulate(parity, part1_columns);
+        write_columns(parity, p, 0, part1_columns);
+        for (int g = 0; g < aux_groups; g++) {
+          load_group(&p[g * GROUP_BYTES], &groups[(info_groups + g) * GROUP_WORDS]);
+        }
+        parity_columns(groups, parity, part1_columns, part1_columns + part2_columns);
+        write_columns(parity, &p[part1_columns * GROUP_BYTES], part1_columns, part1_columns + part2_columns);
+      }
+      else {
+        accumulate(parity, part1_columns);
+        write_transposed(parity, p, part1_columns);
+      }
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
@@ -0,0 +1,74 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_LDPC_PACKED_H
+#define INCLUDED_ATSC3_LDPC_PACKED_H
+
+#include <cstdint>
+#include <vector>
+#include "ldpc_tables.h"
+#include "params.h"
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Packed-bit LDPC encoder using the quasi-cyclic structure of
+     * the A/322 parity check matrices.
+     *
+     * Every table entry x of information group g connects the 360
+     * bits of that group to the 360 parity bits of one parity column
+     * (x mod Q) with a cyclic shift of (x div Q). The parity column
+     * is therefore the XOR of rotated 360-bit information groups,
+     * which is computed on 64-bit words instead of single bits.
+     *
+     * The codeword is MSB first packed, 8 bits per byte.
+     */
+    class ldpc_packed
+    {
+     public:
+      ldpc_packed(atsc3_framesize_t framesize, atsc3_code_rate_t rate);
+
+      /* Size of the per-thread scratch buffer passed to encode(). */
+      int scratch_words() const { return scratch_size; }
+
+      /*
+       * frame holds nbch / 8 information bytes, the parity is appended.
+       * The tables are read-only, so threads with separate scratch
+       * buffers may encode concurrently.
+       */
+      void encode(unsigned char* frame, uint64_t* scratch) const;
+
+     private:
+      int nbch;
+      int ldpc_type;
+      int info_groups;
+      int aux_groups;
+      int part1_columns;
+      int part2_columns;
+      int scratch_size;
+
+      std::vector<uint32_t> column_start; // first entry of each parity column
+      std::vector<uint32_t> column_entry; // (word offset << 6) | bit shift
+
+      /*
+       * The scratch buffer holds the rotation buffers (GROUP_WORDS per
+       * group) followed by the parity columns (PARITY_WORDS per column).
+       */
+      void init(const ldpc_table_t& table, const fec_params_t& p);
+      void add_column(const ldpc_table_t& table, int c);
+      void load_group(const unsigned char* bytes, uint64_t* words) const;
+      void parity_columns(const uint64_t* groups, uint64_t* parity, int first, int last) const;
+      void accumulate(uint64_t* parity, int columns) const;
+      void write_columns(const uint64_t* parity, unsigned char* out, int first, int last) const;
+      void write_transposed(const uint64_t* parity, unsigned char* out, int columns) const;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_LDPC_PACKED_H */
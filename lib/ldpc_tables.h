@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2021-2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_LDPC_TABLES_H
+#define INCLUDED_ATSC3_LDPC_TABLES_H
+
+#include <cstdint>
+#include <atsc3/atsc3_config.h>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * A/322 LDPC parity check matrix in quasi-cyclic compressed row
+     * form, generated at compile time from the parity bit address
+     * tables.
+     *
+     * The parity bits are split into column classes of 360 bits that
+     * share one address list, entry[offset[c]] to entry[offset[c + 1] - 1]
+     * for class c. An entry 360 * g + s is the information bit of
+     * group g connected to parity bit 0 of the class, parity bit r
+     * of the class is connected to 360 * g + (s + r) % 360.
+     *
+     * Classes 0 to q1 - 1 are the accumulated parity (part 1 of type A
+     * codes, all parity of type B codes with q1 = Q). Classes q1 to
+     * q1 + q2 - 1 are part 2 of type A codes, classes q1 + q2 to
+     * q1 + 2 * q2 - 1 the contribution of the part 1 parity bits to
+     * part 2, which are addressed as information bits nbch and up.
+     */
+    struct ldpc_table_t {
+      const uint16_t* offset;
+      const uint16_t* entry;
+      int columns;
+    };
+
+    ldpc_table_t ldpc_table(atsc3_framesize_t framesize, atsc3_code_rate_t rate);
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_LDPC_TABLES_H */
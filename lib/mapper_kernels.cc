@@ -0,0 +1,146 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "mapper_kernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MAPPER_KERNELS_X86
+#endif
+
+namespace gr {
+  namespace atsc3 {
+
+    static inline void
+    map_tail(const unsigned short* in, int first, int cells, int mask, const gr_complex* table, gr_complex* out)
+    {
+      for (int j = first; j < cells; j++) {
+        out[j] = table[in[j] & mask];
+      }
+    }
+
+    static void
+    map_generic(const unsigned short* in, int cells, int mask, const gr_complex* table, gr_complex* out)
+    {
+      map_tail(in, 0, cells, mask, table, out);
+    }
+
+#ifdef MAPPER_KERNELS_X86
+/*
+ * The masked gathers with a zero source (and the masked AVX-512
+ * conversions) keep GCC from warning about the undefined pass-through
+ * register of the plain forms.
+ */
+
+    __attribute__((target("avx2"))) static void
+    map_gather_avx2(const unsigned short* in, int cells, int mask, const gr_complex* table, gr_complex* out)
+    {
+      const __m256i m = _mm256_set1_epi32(mask);
+      const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+      const double* t = (const double*)table;
+      int j = 0;
+
+      for (; j + 8 <= cells; j += 8) {
+        const __m256i index = _mm256_and_si256(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&in[j])), m);
+        const __m256d p0 = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), t, _mm256_castsi256_si128(index), all, 8);
+        const __m256d p1 = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), t, _mm256_extracti128_si256(index, 1), all, 8);
+        _mm256_storeu_pd((double*)&out[j], p0);
+        _mm256_storeu_pd((double*)&out[j + 4], p1);
+      }
+      map_tail(in, j, cells, mask, table, out);
+    }
+
+/*
+ * The four QPSK points are the eight floats of one register, point i
+ * is selected by the float pair (2i, 2i + 1).
+ */
+
+    __attribute__((target("avx2"))) static void
+    map_qpsk_avx2(const unsigned short* in, int cells, int mask, const gr_complex* table, gr_complex* out)
+    {
+      const __m256 t = _mm256_loadu_ps((const float*)table);
+      const __m256i m = _mm256_set1_epi64x(mask);
+      const __m256i one = _mm256_set1_epi64x(1);
+      int j = 0;
+
+      for (; j + 8 <= cells; j += 8) {
+        const __m128i in16 = _mm_loadu_si128((const __m128i*)&in[j]);
+        const __m256i i0 = _mm256_slli_epi64(_mm256_and_si256(_mm256_cvtepu16_epi64(in16), m), 1);
+        const __m256i i1 = _mm256_slli_epi64(_mm256_and_si256(_mm256_cvtepu16_epi64(_mm_srli_si128(in16, 8)), m), 1);
+        const __m256i p0 = _mm256_or_si256(i0, _mm256_slli_epi64(_mm256_add_epi64(i0, one), 32));
+        const __m256i p1 = _mm256_or_si256(i1, _mm256_slli_epi64(_mm256_add_epi64(i1, one), 32));
+        _mm256_storeu_ps((float*)&out[j], _mm256_permutevar8x32_ps(t, p0));
+        _mm256_storeu_ps((float*)&out[j + 4], _mm256_permutevar8x32_ps(t, p1));
+      }
+      map_tail(in, j, cells, mask, table, out);
+    }
+
+    __attribute__((target("avx512f"))) static void
+    map_gather_avx512(const unsigned short* in, int cells, int mask, const gr_complex* table, gr_complex* out)
+    {
+      const __m256i m = _mm256_set1_epi32(mask);
+      const double* t = (const double*)table;
+      int j = 0;
+
+      for (; j + 16 <= cells; j += 16) {
+        const __m256i i0 = _mm256_and_si256(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&in[j])), m);
+        const __m256i i1 = _mm256_and_si256(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&in[j + 8])), m);
+        const __m512d p0 = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xff, i0, t, 8);
+        const __m512d p1 = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xff, i1, t, 8);
+        _mm512_storeu_pd((double*)&out[j], p0);
+        _mm512_storeu_pd((double*)&out[j + 8], p1);
+      }
+      map_tail(in, j, cells, mask, table, out);
+    }
+
+    /* Up to 16 points are held in two registers and selected with vpermt2pd. */
+    __attribute__((target("avx512f"))) static void
+    map_permute_avx512(const unsigned short* in, int cells, int mask, const gr_complex* table, gr_complex* out)
+    {
+      const __m512d t0 = _mm512_loadu_pd((const double*)&table[0]);
+      const __m512d t1 = _mm512_loadu_pd((const double*)&table[8]);
+      const __m512i m = _mm512_set1_epi64(mask);
+      int j = 0;
+
+      for (; j + 16 <= cells; j += 16) {
+        const __m512i i0 = _mm512_and_si512(_mm512_maskz_cvtepu16_epi64(0xff, _mm_loadu_si128((const __m128i*)&in[j])), m);
+        const __m512i i1 = _mm512_and_si512(_mm512_maskz_cvtepu16_epi64(0xff, _mm_loadu_si128((const __m128i*)&in[j + 8])), m);
+        _mm512_storeu_pd((double*)&out[j], _mm512_permutex2var_pd(t0, i0, t1));
+        _mm512_storeu_pd((double*)&out[j + 8], _mm512_permutex2var_pd(t0, i1, t1));
+      }
+      map_tail(in, j, cells, mask, table, out);
+    }
+#endif
+
+    mapper_kernels::mapper_kernels()
+      : kernel_name("generic"),
+        mask(0),
+        map_kernel(map_generic)
+    {
+    }
+
+    void
+    mapper_kernels::init(int points)
+    {
+      mask = points - 1;
+      map_kernel = map_generic;
+      kernel_name = "generic";
+#ifdef MAPPER_KERNELS_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f")) {
+        map_kernel = (points <= 16) ? map_permute_avx512 : map_gather_avx512;
+        kernel_name = (points <= 16) ? "avx512 permute" : "avx512 gather";
+      }
+      else if (__builtin_cpu_supports("avx2")) {
+        map_kernel = (points <= 4) ? map_qpsk_avx2 : map_gather_avx2;
+        kernel_name = (points <= 4) ? "avx2 permute" : "avx2 gather";
+      }
+#endif
+    }
+
+  } /* namespace atsc3 */
+} /* namespace gr */
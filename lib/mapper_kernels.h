@@ -0,0 +1,55 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Ron Economos.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_ATSC3_MAPPER_KERNELS_H
+#define INCLUDED_ATSC3_MAPPER_KERNELS_H
+
+#include <gnuradio/gr_complex.h>
+#include <string>
+
+namespace gr {
+  namespace atsc3 {
+
+    /*
+     * Runtime dispatched constellation mapping kernels.
+     *
+     * A cell index selects one gr_complex point, which is a 64-bit
+     * I/Q pair, so the point tables are mapped as tables of doubles.
+     * AVX2 and AVX-512 gather 4 or 8 points per instruction, the small
+     * constellations are permuted within registers instead: QPSK with
+     * vpermps (AVX2) or vpermpd (AVX-512), 16QAM with vpermt2pd.
+     *
+     * The indices are masked to the table size. The table must hold at
+     * least 16 points (see constellation_table()).
+     */
+    class mapper_kernels
+    {
+     public:
+      mapper_kernels();
+
+      /* Select the kernel for a table of points entries (a power of 2). */
+      void init(int points);
+
+      void map(const unsigned short* in, int cells, const gr_complex* table, gr_complex* out) const
+      {
+        map_kernel(in, cells, mask, table, out);
+      }
+
+      const std::string& name() const { return kernel_name; }
+
+     private:
+      typedef void (*map_kernel_t)(const unsigned short* in, int cells, int mask, const gr_complex* table, gr_complex* out);
+
+      std::string kernel_name;
+      int mask;
+      map_kernel_t map_kernel;
+    };
+
+  } // namespace atsc3
+} // namespace gr
+
+#endif /* INCLUDED_ATSC3_MAPPER_KERNELS_H */
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(alpbbheader_bb.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(ecc826681ab36e1629cf1b9c5f9b4942)                     */
+/* BINDTOOL_HEADER_FILE_HASH(dedb76d8fd9d4b424b8670ade3d3f1d9)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -41,6 +41,7 @@ void bind_alpbbheader_bb(py::module& m)
            py::arg("rate"),
            py::arg("llsmode"),
            py::arg("llscount"),
+           py::arg("packed") = ::gr::atsc3::atsc3_packed_mode_t::PACKED_OFF,
            D(alpbbheader_bb,make)
         )
         
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(atsc3_config.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(ef04e423f6a3738c3e01c85408c4ee74)                     */
+/* BINDTOOL_HEADER_FILE_HASH(398ef2dd58d03f513ce5028666fe85f4)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -382,6 +382,21 @@ void bind_atsc3_config(py::module& m)
     ;
 
     py::implicitly_convertible<int, ::gr::atsc3::atsc3_lls_service_count_t>();
+    py::enum_<::gr::atsc3::atsc3_packed_mode_t>(m,"atsc3_packed_mode_t")
+        .value("PACKED_OFF", ::gr::atsc3::atsc3_packed_mode_t::PACKED_OFF) // 0
+        .value("PACKED_ON", ::gr::atsc3::atsc3_packed_mode_t::PACKED_ON) // 1
+        .export_values()
+    ;
+
+    py::implicitly_convertible<int, ::gr::atsc3::atsc3_packed_mode_t>();
+
+    py::enum_<::gr::atsc3::atsc3_ti_address_mode_t>(m,"atsc3_ti_address_mode_t")
+        .value("TI_ADDRESS_TABLE", ::gr::atsc3::atsc3_ti_address_mode_t::TI_ADDRESS_TABLE) // 0
+        .value("TI_ADDRESS_GENERATED", ::gr::atsc3::atsc3_ti_address_mode_t::TI_ADDRESS_GENERATED) // 1
+        .export_values()
+    ;
+
+    py::implicitly_convertible<int, ::gr::atsc3::atsc3_ti_address_mode_t>();
 
 
 
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(bbscrambler_bb.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(24f8adf88609ef400b6f2b9ed67dd7b6)                     */
+/* BINDTOOL_HEADER_FILE_HASH(91a95f3be10018abe5672530f09366a3)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -40,6 +40,7 @@ void bind_bbscrambler_bb(py::module& m)
            py::arg("framesize"),
            py::arg("rate"),
            py::arg("fecmode"),
+           py::arg("packed") = ::gr::atsc3::atsc3_packed_mode_t::PACKED_OFF,
            D(bbscrambler_bb,make)
         )
         
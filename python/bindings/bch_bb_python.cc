@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(bch_bb.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(ce55e7be835f09acdc575943b9adc1ad)                     */
+/* BINDTOOL_HEADER_FILE_HASH(e10c362c603b5313169598bd96741d5a)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -40,6 +40,7 @@ void bind_bch_bb(py::module& m)
            py::arg("framesize"),
            py::arg("rate"),
            py::arg("fecmode"),
+           py::arg("packed") = ::gr::atsc3::atsc3_packed_mode_t::PACKED_OFF,
            D(bch_bb,make)
         )
         
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2021 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(bicm_bc.h)                                               */
+/* BINDTOOL_HEADER_FILE_HASH(b326d334611086b339706a6fee97d189)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <atsc3/bicm_bc.h>
+// pydoc.h is automatically generated in the build directory
+#include <bicm_bc_pydoc.h>
+
+void bind_bicm_bc(py::module& m)
+{
+
+    using bicm_bc    = ::gr::atsc3::bicm_bc;
+
+
+    py::class_<bicm_bc, gr::block, gr::basic_block,
+        std::shared_ptr<bicm_bc>>(m, "bicm_bc", D(bicm_bc))
+
+        .def(py::init(&bicm_bc::make),
+           py::arg("framesize"),
+           py::arg("rate"),
+           py::arg("constellation"),
+           py::arg("packed"),
+           D(bicm_bc,make)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -25,3 +25,8 @@
  static const char *__doc_gr_atsc3_ldpc_bb_make = R"doc()doc";
 
   
+
+
+ static const char *__doc_gr_atsc3_ldpc_bb_kernel_name = R"doc()doc";
+
+  
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(fdmframemapper_cc.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(01e9316ad17a33d191ecccea7abe99fd)                     */
+/* BINDTOOL_HEADER_FILE_HASH(ed86157ea13141efd522aa0a9379074c)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -74,6 +74,7 @@ void bind_fdmframemapper_cc(py::module& m)
            py::arg("paprmode"),
            py::arg("l1bmode"),
            py::arg("l1dmode"),
+           py::arg("tiaddress"),
            D(fdmframemapper_cc,make)
         )
         
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2021 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(fec_encoder_bb.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(48df87489c23d989d1afc77e8a6e83fe)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <atsc3/fec_encoder_bb.h>
+// pydoc.h is automatically generated in the build directory
+#include <fec_encoder_bb_pydoc.h>
+
+void bind_fec_encoder_bb(py::module& m)
+{
+
+    using fec_encoder_bb    = ::gr::atsc3::fec_encoder_bb;
+
+
+    py::class_<fec_encoder_bb, gr::block, gr::basic_block,
+        std::shared_ptr<fec_encoder_bb>>(m, "fec_encoder_bb", D(fec_encoder_bb))
+
+        .def(py::init(&fec_encoder_bb::make),
+           py::arg("framesize"),
+           py::arg("rate"),
+           py::arg("fecmode"),
+           py::arg("packed"),
+           D(fec_encoder_bb,make)
+        )
+        
+
+        .def("pool_acquired",&fec_encoder_bb::pool_acquired,
+            D(fec_encoder_bb,pool_acquired)
+        )
+
+
+        .def("pool_overflows",&fec_encoder_bb::pool_overflows,
+            D(fec_encoder_bb,pool_overflows)
+        )
+
+
+        .def("pool_buffers",&fec_encoder_bb::pool_buffers,
+            D(fec_encoder_bb,pool_buffers)
+        )
+
+
+        .def("pool_peak",&fec_encoder_bb::pool_peak,
+            D(fec_encoder_bb,pool_peak)
+        )
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
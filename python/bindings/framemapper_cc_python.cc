@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(framemapper_cc.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(e13df1ad04de4b1ff07ca751a316edf1)                     */
+/* BINDTOOL_HEADER_FILE_HASH(d4c8879315b9d32d602ef884464f3ac4)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -64,6 +64,7 @@ void bind_framemapper_cc(py::module& m)
            py::arg("paprmode"),
            py::arg("l1bmode"),
            py::arg("l1dmode"),
+           py::arg("tiaddress"),
            D(framemapper_cc,make)
         )
         
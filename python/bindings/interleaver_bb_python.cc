@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(interleaver_bb.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(8ed81281b1ff266601e080ccdee2014d)                     */
+/* BINDTOOL_HEADER_FILE_HASH(8ab9d0e41b93ed99ac8dceb55df361ea)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -40,6 +40,7 @@ void bind_interleaver_bb(py::module& m)
            py::arg("framesize"),
            py::arg("rate"),
            py::arg("constellation"),
+           py::arg("packed") = ::gr::atsc3::atsc3_packed_mode_t::PACKED_OFF,
            D(interleaver_bb,make)
         )
         
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(ldmframemapper_cc.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(9acdd1e7934cedd4fa0010ad57dc0da0)                     */
+/* BINDTOOL_HEADER_FILE_HASH(a7a58356665f848265015aa76c90b936)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -69,6 +69,7 @@ void bind_ldmframemapper_cc(py::module& m)
            py::arg("paprmode"),
            py::arg("l1bmode"),
            py::arg("l1dmode"),
+           py::arg("tiaddress"),
            D(ldmframemapper_cc,make)
         )
         
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(ldpc_bb.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(29d63b4e64872083f2f505e0a4c5a83d)                     */
+/* BINDTOOL_HEADER_FILE_HASH(cc1a383c5f3b81eaf6c6811bb1f40440)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -39,10 +39,16 @@ void bind_ldpc_bb(py::module& m)
         .def(py::init(&ldpc_bb::make),
            py::arg("framesize"),
            py::arg("rate"),
+           py::arg("packed") = ::gr::atsc3::atsc3_packed_mode_t::PACKED_OFF,
+           py::arg("threads") = 1,
            D(ldpc_bb,make)
         )
         
 
+        .def("kernel_name",&ldpc_bb::kernel_name,
+            D(ldpc_bb,kernel_name)
+        )
+
 
 
         ;
@@ -40,6 +40,8 @@ namespace py = pybind11;
     void bind_cyclicprefixer_cc(py::module& m);
     void bind_tdmframemapper_cc(py::module& m);
     void bind_fdmframemapper_cc(py::module& m);
+    void bind_fec_encoder_bb(py::module& m);
+    void bind_bicm_bc(py::module& m);
 // ) END BINDING_FUNCTION_PROTOTYPES
 
 
@@ -68,8 +70,8 @@ PYBIND11_MODULE(atsc3_python, m)
     // Please do not delete
     /**************************************/
     // BINDING_FUNCTION_CALLS(
-    bind_bbscrambler_bb(m);
     bind_atsc3_config(m);
+    bind_bbscrambler_bb(m);
     bind_bch_bb(m);
     bind_ldpc_bb(m);
     bind_interleaver_bb(m);
@@ -87,5 +89,7 @@ PYBIND11_MODULE(atsc3_python, m)
     bind_cyclicprefixer_cc(m);
     bind_tdmframemapper_cc(m);
     bind_fdmframemapper_cc(m);
+    bind_fec_encoder_bb(m);
+    bind_bicm_bc(m);
     // ) END BINDING_FUNCTION_CALLS
 }
\ No newline at end of file
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(subframemapper_cc.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(373cb980540ff9abc381be24990d5b8d)                     */
+/* BINDTOOL_HEADER_FILE_HASH(f4b069d4ae4415347daa32b7289d5d31)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -82,6 +82,7 @@ void bind_subframemapper_cc(py::module& m)
            py::arg("paprmode"),
            py::arg("l1bmode"),
            py::arg("l1dmode"),
+           py::arg("tiaddress"),
            D(subframemapper_cc,make)
         )
         
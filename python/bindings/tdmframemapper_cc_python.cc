@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(tdmframemapper_cc.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(9617d80ce1f8ff7df01ee1cd7598d84d)                     */
+/* BINDTOOL_HEADER_FILE_HASH(37903f0e97eb21b742ec288cbad6db06)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -74,6 +74,7 @@ void bind_tdmframemapper_cc(py::module& m)
            py::arg("paprmode"),
            py::arg("l1bmode"),
            py::arg("l1dmode"),
+           py::arg("tiaddress"),
            D(tdmframemapper_cc,make)
         )
         
@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2025 Ron Economos.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+import random
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+    from atsc3 import bicm_bc, interleaver_bb, modulator_bc
+    from atsc3 import FECFRAME_SHORT, FECFRAME_NORMAL, C2_15, C8_15, C13_15
+    from atsc3 import MOD_QPSK, MOD_16QAM, MOD_64QAM, MOD_256QAM, MOD_1024QAM, MOD_4096QAM
+    from atsc3 import PACKED_OFF, PACKED_ON
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from atsc3 import bicm_bc, interleaver_bb, modulator_bc
+    from atsc3 import FECFRAME_SHORT, FECFRAME_NORMAL, C2_15, C8_15, C13_15
+    from atsc3 import MOD_QPSK, MOD_16QAM, MOD_64QAM, MOD_256QAM, MOD_1024QAM, MOD_4096QAM
+    from atsc3 import PACKED_OFF, PACKED_ON
+
+FRAMES = 3
+
+def pack_bits(bits):
+    return [sum(bits[i + j] << (7 - j) for j in range(8)) for i in range(0, len(bits), 8)]
+
+class qa_bicm_bc(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+
+    def tearDown(self):
+        self.tb = None
+
+    def run_blocks(self, data, chain):
+        self.tb = gr.top_block()
+        src = blocks.vector_source_b(data)
+        dst = blocks.vector_sink_c()
+        self.tb.connect(src, *chain)
+        self.tb.connect(chain[-1], dst)
+        self.tb.run()
+        return dst.data()
+
+    def test_instance(self):
+        instance = bicm_bc(FECFRAME_NORMAL, C8_15, MOD_256QAM, PACKED_ON)
+
+    def test_001_matches_separate_blocks(self):
+        random.seed(1)
+        for framesize, frame_size, constellations in (
+                (FECFRAME_SHORT, 16200, (MOD_QPSK, MOD_16QAM, MOD_64QAM, MOD_256QAM)),
+                (FECFRAME_NORMAL, 64800, (MOD_QPSK, MOD_16QAM, MOD_64QAM, MOD_256QAM, MOD_1024QAM, MOD_4096QAM))):
+            bits = [random.randint(0, 1) for i in range(FRAMES * frame_size)]
+            for rate in (C2_15, C8_15, C13_15):
+                for constellation in constellations:
+                    for packed in (PACKED_OFF, PACKED_ON):
+                        data = bits if packed == PACKED_OFF else pack_bits(bits)
+                        fused = self.run_blocks(data,
+                            [bicm_bc(framesize, rate, constellation, packed)])
+                        separate = self.run_blocks(data,
+                            [interleaver_bb(framesize, rate, constellation, packed),
+                             modulator_bc(framesize, rate, constellation)])
+                        self.assertGreater(len(fused), 0)
+                        self.assertEqual(len(fused), len(separate))
+                        self.assertComplexTuplesAlmostEqual(fused, separate, 6)
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_bicm_bc)
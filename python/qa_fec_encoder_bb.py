@@ -0,0 +1,148 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+# Copyright 2025 Ron Economos.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+import random
+import time
+from gnuradio import gr, gr_unittest
+from gnuradio import blocks
+try:
+    from atsc3 import fec_encoder_bb, bbscrambler_bb, bch_bb, ldpc_bb, alpbbheader_bb
+    from atsc3 import LLS_OFF, LLS_ONE_SERVICE
+    from atsc3 import FECFRAME_SHORT, FECFRAME_NORMAL, C2_15, C8_15, C13_15
+    from atsc3 import PLP_FEC_NONE, PLP_FEC_CRC32, PLP_FEC_BCH, PACKED_OFF, PACKED_ON
+except ImportError:
+    import os
+    import sys
+    dirname, filename = os.path.split(os.path.abspath(__file__))
+    sys.path.append(os.path.join(dirname, "bindings"))
+    from atsc3 import fec_encoder_bb, bbscrambler_bb, bch_bb, ldpc_bb, alpbbheader_bb
+    from atsc3 import LLS_OFF, LLS_ONE_SERVICE
+    from atsc3 import FECFRAME_SHORT, FECFRAME_NORMAL, C2_15, C8_15, C13_15
+    from atsc3 import PLP_FEC_NONE, PLP_FEC_CRC32, PLP_FEC_BCH, PACKED_OFF, PACKED_ON
+
+# four baseband frames of the largest size (Kbch / 8 = 6996 bytes)
+INPUT_BYTES = 4 * 7020
+
+def unpack_bits(data):
+    return [(b >> (7 - i)) & 1 for b in data for i in range(8)]
+
+class qa_fec_encoder_bb(gr_unittest.TestCase):
+
+    def setUp(self):
+        self.tb = gr.top_block()
+
+    def tearDown(self):
+        self.tb = None
+
+    def run_blocks(self, data, chain):
+        self.tb = gr.top_block()
+        src = blocks.vector_source_b(data)
+        dst = blocks.vector_sink_b()
+        self.tb.connect(src, *chain)
+        self.tb.connect(chain[-1], dst)
+        self.tb.run()
+        return dst.data()
+
+    def test_instance(self):
+        instance = fec_encoder_bb(FECFRAME_SHORT, C8_15, PLP_FEC_BCH, PACKED_ON)
+
+    def test_001_matches_separate_blocks(self):
+        random.seed(1)
+        data = [random.randint(0, 255) for i in range(INPUT_BYTES)]
+        for framesize in (FECFRAME_SHORT, FECFRAME_NORMAL):
+            for rate in (C2_15, C8_15, C13_15):
+                for fecmode in (PLP_FEC_NONE, PLP_FEC_CRC32, PLP_FEC_BCH):
+                    for packed in (PACKED_OFF, PACKED_ON):
+                        fused = self.run_blocks(data,
+                            [fec_encoder_bb(framesize, rate, fecmode, packed)])
+                        separate = self.run_blocks(data if packed == PACKED_ON else unpack_bits(data),
+                            [bbscrambler_bb(framesize, rate, fecmode, packed),
+                             bch_bb(framesize, rate, fecmode, packed),
+                             ldpc_bb(framesize, rate, packed, 1)])
+                        self.assertGreater(len(fused), 0)
+                        self.assertEqual(fused, separate)
+
+    def run_until(self, connect, items):
+        # alpbbheader_bb does not finish on a short input, stop once enough frames are out
+        self.tb = gr.top_block()
+        dst = blocks.vector_sink_b()
+        connect(self.tb, dst)
+        self.tb.start()
+        timeout = time.time() + 10
+        while len(dst.data()) < items and time.time() < timeout:
+            time.sleep(0.01)
+        self.tb.stop()
+        self.tb.wait()
+        self.assertGreaterEqual(len(dst.data()), items)
+        return dst.data()[:items]
+
+    def test_002_frames_match_stream(self):
+        random.seed(2)
+        ts = []
+        for i in range(400):
+            ts += [0x47] + [random.randint(0, 255) for j in range(187)]
+        for framesize in (FECFRAME_SHORT, FECFRAME_NORMAL):
+            for packed in (PACKED_OFF, PACKED_ON):
+                items = 4 * (16200 if framesize == FECFRAME_SHORT else 64800)
+                if packed == PACKED_ON:
+                    items //= 8
+
+                def stream(tb, dst):
+                    header = alpbbheader_bb(framesize, C8_15, LLS_OFF, LLS_ONE_SERVICE, PACKED_ON)
+                    fec = fec_encoder_bb(framesize, C8_15, PLP_FEC_BCH, packed)
+                    tb.connect(blocks.vector_source_b(ts), header, fec, dst)
+                expected = self.run_until(stream, items)
+
+                # frames are packed whatever the packed mode of alpbbheader_bb
+                for header_packed in (PACKED_OFF, PACKED_ON):
+                    def frames(tb, dst):
+                        header = alpbbheader_bb(framesize, C8_15, LLS_OFF, LLS_ONE_SERVICE, header_packed)
+                        fec = fec_encoder_bb(framesize, C8_15, PLP_FEC_BCH, packed)
+                        tb.connect(blocks.vector_source_b(ts), header)
+                        tb.msg_connect((header, "frames"), (fec, "frames"))
+                        tb.connect(fec, dst)
+                    self.assertEqual(self.run_until(frames, items), expected)
+
+    def test_003_frames_follow_slow_sink(self):
+        # an endless source against a throttled sink, the frame pool must
+        # hold alpbbheader_bb back instead of queueing or dropping frames
+        random.seed(3)
+        ts = []
+        for i in range(400):
+            ts += [0x47] + [random.randint(0, 255) for j in range(187)]
+        for framesize in (FECFRAME_SHORT, FECFRAME_NORMAL):
+            items = 64 * (16200 if framesize == FECFRAME_SHORT else 64800) // 8
+
+            def stream(tb, dst):
+                header = alpbbheader_bb(framesize, C8_15, LLS_OFF, LLS_ONE_SERVICE, PACKED_ON)
+                fec = fec_encoder_bb(framesize, C8_15, PLP_FEC_BCH, PACKED_ON)
+                tb.connect(blocks.vector_source_b(ts, True), header, fec, dst)
+            expected = self.run_until(stream, items)
+
+            def frames(tb, dst):
+                header = alpbbheader_bb(framesize, C8_15, LLS_OFF, LLS_ONE_SERVICE, PACKED_ON)
+                fec = fec_encoder_bb(framesize, C8_15, PLP_FEC_BCH, PACKED_ON)
+                throttle = blocks.throttle(gr.sizeof_char, items // 4)
+                tb.connect(blocks.vector_source_b(ts, True), header)
+                tb.msg_connect((header, "frames"), (fec, "frames"))
+                tb.connect(fec, throttle, dst)
+            self.assertEqual(self.run_until(frames, items), expected)
+
+    def test_004_pool_counters(self):
+        random.seed(4)
+        data = [random.randint(0, 255) for i in range(INPUT_BYTES)]
+        fec = fec_encoder_bb(FECFRAME_NORMAL, C8_15, PLP_FEC_BCH, PACKED_OFF)
+        self.run_blocks(data, [fec])
+        self.assertGreater(fec.pool_acquired(), 0)
+        self.assertEqual(fec.pool_overflows(), 0)
+        self.assertGreaterEqual(fec.pool_buffers(), 1)
+        self.assertLessEqual(fec.pool_peak(), fec.pool_buffers())
+
+
+if __name__ == '__main__':
+    gr_unittest.run(qa_fec_encoder_bb)
@@ -6,16 +6,23 @@
 # SPDX-License-Identifier: GPL-3.0-or-later
 #
 
+import random
 from gnuradio import gr, gr_unittest
-# from gnuradio import blocks
+from gnuradio import blocks
 try:
     from atsc3 import ldpc_bb
+    from atsc3 import FECFRAME_SHORT, FECFRAME_NORMAL, C6_15, PACKED_OFF, PACKED_ON
 except ImportError:
     import os
     import sys
     dirname, filename = os.path.split(os.path.abspath(__file__))
     sys.path.append(os.path.join(dirname, "bindings"))
     from atsc3 import ldpc_bb
+    from atsc3 import FECFRAME_SHORT, FECFRAME_NORMAL, C6_15, PACKED_OFF, PACKED_ON
+
+# information bits of one FECFRAME at rate 6/15
+NBCH = {FECFRAME_SHORT: 6480, FECFRAME_NORMAL: 25920}
+FRAMES = 8
 
 class qa_ldpc_bb(gr_unittest.TestCase):
 
@@ -25,14 +32,34 @@ class qa_ldpc_bb(gr_unittest.TestCase):
     def tearDown(self):
         self.tb = None
 
+    def run_ldpc(self, data, framesize, packed, threads):
+        self.tb = gr.top_block()
+        src = blocks.vector_source_b(data)
+        ldpc = ldpc_bb(framesize, C6_15, packed, threads)
+        dst = blocks.vector_sink_b()
+        self.tb.connect(src, ldpc, dst)
+        self.tb.run()
+        return dst.data()
+
     def test_instance(self):
-        # FIXME: Test will fail until you pass sensible arguments to the constructor
-        instance = ldpc_bb()
+        instance = ldpc_bb(FECFRAME_SHORT, C6_15, PACKED_OFF, 1)
 
-    def test_001_descriptive_test_name(self):
-        # set up fg
-        self.tb.run()
-        # check data
+    def test_001_threads_match_single_thread(self):
+        # every run starts the worker pool and calls work straight away
+        random.seed(1)
+        for framesize in (FECFRAME_SHORT, FECFRAME_NORMAL):
+            for packed in (PACKED_OFF, PACKED_ON):
+                size = NBCH[framesize] * FRAMES
+                if packed == PACKED_ON:
+                    size //= 8
+                    data = [random.randint(0, 255) for i in range(size)]
+                else:
+                    data = [random.randint(0, 1) for i in range(size)]
+                expected = self.run_ldpc(data, framesize, packed, 1)
+                self.assertGreater(len(expected), 0)
+                for threads in (2, 4):
+                    for run in range(4):
+                        self.assertEqual(self.run_ldpc(data, framesize, packed, threads), expected)
 
 
 if __name__ == '__main__':